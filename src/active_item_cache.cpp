@@ -47,20 +47,19 @@ bool active_item_cache::add( item &it, point_rel_ms location, item *parent,
     if( speed == item::NO_PROCESSING ) {
         return ret;
     }
-    std::unordered_map<item *, safe_reference<item>> &target_index = active_items_index[speed];
-    std::list<item_reference> &target_list = active_items[speed];
-    if( target_index.empty() && !target_index.empty() ) {
+    bucket &target = active_items[speed];
+    if( target.index.empty() && !target.items.empty() ) {
         // If the index has been cleared, rebuild it first.
-        for( item_reference &iter : target_list ) {
+        for( item_reference &iter : target.items ) {
             // Omit those expired references
             if( iter.item_ref ) {
-                target_index.emplace( iter.item_ref.get(), iter.item_ref );
+                target.index.emplace( iter.item_ref.get(), iter.item_ref );
             }
         }
     }
     // If the item is already in the cache for some reason, don't add a second reference
-    auto iter = target_index.find( &it );
-    if( iter != target_index.end() ) {
+    auto iter = target.index.find( &it );
+    if( iter != target.index.end() ) {
         // Ensure it's really what we want, and hasn't expired
         if( iter->second && iter->second.get() == &it ) {
             return true;
@@ -73,31 +72,58 @@ bool active_item_cache::add( item &it, point_rel_ms location, item *parent,
     if( it.get_use( "explosion" ) ) {
         special_items[special_item_type::explosive].emplace_back( ref );
     }
-    target_list.emplace_back( std::move( ref ) );
-    target_index.emplace( &it, it.get_safe_reference() );
+    target.items.emplace_back( std::move( ref ) );
+    target.index.insert_or_assign( &it, it.get_safe_reference() );
     return true;
 }
 
+void active_item_cache::bucket::compact()
+{
+    std::size_t kept = 0;
+    std::size_t removed_before_next = 0;
+    for( std::size_t i = 0; i < items.size(); ++i ) {
+        if( !items[i].item_ref ) {
+            if( i < next ) {
+                ++removed_before_next;
+            }
+            continue;
+        }
+        if( kept != i ) {
+            items[kept] = std::move( items[i] );
+        }
+        ++kept;
+    }
+    items.erase( items.begin() + kept, items.end() );
+    next -= removed_before_next;
+    if( next >= items.size() ) {
+        next = 0;
+    }
+    // The expired references can't tell which index entries they owned.
+    index.clear();
+}
+
 bool active_item_cache::empty() const
 {
     return std::all_of( active_items.begin(), active_items.end(), []( const auto & active_queue ) {
-        return active_queue.second.empty();
+        return active_queue.second.items.empty();
     } );
 }
 
 std::vector<item_reference> active_item_cache::get()
 {
     std::vector<item_reference> all_cached_items;
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        for( std::list<item_reference>::iterator it = kv.second.begin(); it != kv.second.end(); ) {
-            if( it->item_ref ) {
-                all_cached_items.emplace_back( *it );
-                ++it;
+    for( std::pair<const int, bucket> &kv : active_items ) {
+        bool has_tombstones = false;
+        for( const item_reference &ref : kv.second.items ) {
+            if( ref.item_ref ) {
+                all_cached_items.emplace_back( ref );
             } else {
-                active_items_index[kv.first].clear();
-                it = kv.second.erase( it );
+                has_tombstones = true;
             }
         }
+        if( has_tombstones ) {
+            kv.second.compact();
+        }
     }
     return all_cached_items;
 }
@@ -105,51 +131,59 @@ std::vector<item_reference> active_item_cache::get()
 std::vector<item_reference> active_item_cache::get_for_processing()
 {
     std::vector<item_reference> items_to_process;
+    get_for_processing( items_to_process );
+    return items_to_process;
+}
+
+void active_item_cache::get_for_processing( std::vector<item_reference> &items_to_process )
+{
+    items_to_process.clear();
     items_to_process.reserve( std::accumulate( active_items.begin(), active_items.end(), std::size_t{ 0 },
     []( size_t prev, const auto & kv ) {
-        return prev + kv.second.size() / static_cast<size_t>( kv.first );
+        return prev + kv.second.items.size() / static_cast<size_t>( kv.first ) + 1;
     } ) );
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
+    for( std::pair<const int, bucket> &kv : active_items ) {
+        bucket &b = kv.second;
+        const std::size_t size = b.items.size();
         // Rely on iteration logic to make sure the number is sane.
-        int num_to_process = kv.second.size() / kv.first;
-        std::list<item_reference>::iterator it = kv.second.begin();
-        for( ; it != kv.second.end() && num_to_process >= 0; ) {
-            if( it->item_ref ) {
-                items_to_process.push_back( *it );
+        int num_to_process = size / kv.first;
+        bool has_tombstones = false;
+        std::size_t visited = 0;
+        for( ; visited < size && num_to_process >= 0; ++visited ) {
+            const item_reference &ref = b.items[( b.next + visited ) % size];
+            if( ref.item_ref ) {
+                items_to_process.push_back( ref );
                 --num_to_process;
-                ++it;
             } else {
-                // The item has been destroyed, so remove the reference from the cache
-                active_items_index[kv.first].clear();
-                it = kv.second.erase( it );
+                // The item has been destroyed, leave it for compaction below
+                has_tombstones = true;
             }
         }
-        // Rotate the returned items to the end of their list so that the items that weren't
+        // Continue after the returned items next time, so that the items that weren't
         // returned this time will be first in line on the next call
-        kv.second.splice( kv.second.end(), kv.second, kv.second.begin(), it );
+        b.next = size == 0 ? 0 : ( b.next + visited ) % size;
+        if( has_tombstones ) {
+            b.compact();
+        }
     }
-    return items_to_process;
 }
 
 std::vector<item_reference> active_item_cache::get_special( special_item_type type )
 {
     std::vector<item_reference> matching_items;
-    std::list<item_reference> &items = special_items[type];
-    for( auto it = items.begin(); it != items.end(); ) {
-        if( it->item_ref ) {
-            matching_items.push_back( *it );
-            ++it;
-        } else {
-            it = items.erase( it );
-        }
-    }
+    std::vector<item_reference> &items = special_items[type];
+    items.erase( std::remove_if( items.begin(), items.end(), []( const item_reference & ref ) {
+        return !ref.item_ref;
+    } ), items.end() );
+    matching_items.reserve( items.size() );
+    matching_items.insert( matching_items.end(), items.begin(), items.end() );
     return matching_items;
 }
 
 void active_item_cache::subtract_locations( const point_rel_ms &delta )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
+    for( std::pair<const int, bucket> &pair : active_items ) {
+        for( item_reference &ir : pair.second.items ) {
             ir.location -= delta;
         }
     }
@@ -157,8 +191,8 @@ void active_item_cache::subtract_locations( const point_rel_ms &delta )
 
 void active_item_cache::rotate_locations( int turns, const point_rel_ms &dim )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
+    for( std::pair<const int, bucket> &pair : active_items ) {
+        for( item_reference &ir : pair.second.items ) {
             // Should 'rotate' be propaged up to the typed coordinates?
             ir.location = point_rel_ms( ir.location.raw().rotate( turns, dim.raw() ) );
         }
@@ -167,8 +201,8 @@ void active_item_cache::rotate_locations( int turns, const point_rel_ms &dim )
 
 void active_item_cache::mirror( const point_rel_ms &dim, bool horizontally )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
+    for( std::pair<const int, bucket> &pair : active_items ) {
+        for( item_reference &ir : pair.second.items ) {
             if( horizontally ) {
                 ir.location.x() = dim.x() - 1 - ir.location.x();
             } else {
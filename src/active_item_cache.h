@@ -3,7 +3,6 @@
 #define CATA_SRC_ACTIVE_ITEM_CACHE_H
 
 #include <cstddef>
-#include <list>
 #include <unordered_map>
 #include <vector>
 
@@ -51,9 +50,23 @@ struct hash<special_item_type> {
 class active_item_cache
 {
     private:
-        std::unordered_map<int, std::list<item_reference>> active_items;
-        std::unordered_map<special_item_type, std::list<item_reference>> special_items;
-        std::unordered_map<int, std::unordered_map<item *, safe_reference<item>>> active_items_index;
+        /**
+         * Contiguous ring of references sharing one processing speed.
+         * Expired references are left in place as tombstones and compacted in a single
+         * pass by whichever call runs into them.
+         */
+        struct bucket {
+            std::vector<item_reference> items;
+            // Position in items of the first reference to hand out on the next get_for_processing()
+            std::size_t next = 0;
+            // Lazily rebuilt from items after compaction, see add()
+            std::unordered_map<item *, safe_reference<item>> index;
+
+            /** Drops expired references, keeping next on the same live reference. */
+            void compact();
+        };
+        std::unordered_map<int, bucket> active_items;
+        std::unordered_map<special_item_type, std::vector<item_reference>> special_items;
     public:
         /**
          * Adds the reference to the cache. Does nothing if the reference is already in the cache.
@@ -78,14 +91,16 @@ class active_item_cache
         std::vector<item_reference> get();
 
         /**
-         * Returns the first size() / processing_speed() elements of each list, rounded up.
-         * Items returned are rotated to the back of their respective lists, otherwise only the
-         * first n items will ever be processed.
+         * Returns the next size() / processing_speed() elements of each bucket, rounded up.
+         * Each bucket remembers where it stopped, so the following call continues with the
+         * items that weren't returned this time, otherwise only the first n would ever be processed.
          * Broken references encountered when collecting the items to be processed are removed from
          * the cache.
          * Relies on the fact that item::processing_speed() is a constant.
          */
         std::vector<item_reference> get_for_processing();
+        /** As above, but fills items_to_process (after clearing it) so callers can reuse it. */
+        void get_for_processing( std::vector<item_reference> &items_to_process );
 
         /**
          * Returns the currently tracked list of special active items.
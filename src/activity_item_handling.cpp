@@ -10,6 +10,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -145,6 +146,7 @@ static const zone_type_id zone_type_LOOT_CORPSE( "LOOT_CORPSE" );
 static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_IGNORE( "LOOT_IGNORE" );
 static const zone_type_id zone_type_LOOT_IGNORE_FAVORITES( "LOOT_IGNORE_FAVORITES" );
+static const zone_type_id zone_type_LOOT_ITEM_GROUP( "LOOT_ITEM_GROUP" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
 static const zone_type_id zone_type_LOOT_WOOD( "LOOT_WOOD" );
 static const zone_type_id zone_type_MINING( "MINING" );
@@ -1450,14 +1452,15 @@ static void add_basecamp_storage_to_loot_zone_list(
             std::unordered_set<tripoint_abs_ms> bc_storage_set =
                 mgr.get_near( zone_type_CAMP_STORAGE, here.getglobal( src_loc ),
                               ACTIVITY_SEARCH_DISTANCE, nullptr, _fac_id( you ) );
+            std::unordered_set<tripoint_bub_ms> combined_set( combined_spots.begin(),
+                    combined_spots.end() );
             for( const tripoint_abs_ms &elem : bc_storage_set ) {
                 tripoint_bub_ms here_local = here.bub_from_abs( elem );
 
                 // Check that a coordinate is not already in the combined list, otherwise actions
                 // like construction may erroneously count materials twice if an object is both
                 // in the camp zone and in a loot zone.
-                if( std::find( combined_spots.begin(), combined_spots.end(),
-                               here_local ) == combined_spots.end() ) {
+                if( combined_set.insert( here_local ).second ) {
                     loot_zone_spots.push_back( here_local );
                     combined_spots.push_back( here_local );
                 }
@@ -1493,6 +1496,7 @@ static std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> requirements_map(
     std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> final_map;
     std::vector<tripoint_bub_ms> loot_spots;
     std::vector<tripoint_bub_ms> already_there_spots;
+    std::unordered_set<tripoint_bub_ms> already_there_set;
     std::vector<tripoint_bub_ms> combined_spots;
     std::map<itype_id, int> total_map;
     map &here = get_map();
@@ -1500,15 +1504,15 @@ static std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> requirements_map(
     for( const tripoint_bub_ms &elem : here.points_in_radius( src_loc,
             PICKUP_RANGE - 1 ) ) {
         already_there_spots.push_back( elem );
+        already_there_set.insert( elem );
         combined_spots.push_back( elem );
     }
     // TODO: fix point types
     for( const tripoint &elem : mgr.get_point_set_loot(
              you.get_location(), distance, you.is_npc(), _fac_id( you ) ) ) {
         // if there is a loot zone that's already near the work spot, we don't want it to be added twice.
-        if( std::find( already_there_spots.begin(), already_there_spots.end(),
-                       // TODO: fix point types
-                       tripoint_bub_ms( elem ) ) != already_there_spots.end() ) {
+        // TODO: fix point types
+        if( already_there_set.count( tripoint_bub_ms( elem ) ) ) {
             // construction tasks don't need the loot spot *and* the already_there/combined spots both added.
             // but a farming task will need to go and fetch the tool no matter if its near the work spot.
             // whereas the construction will automatically use what's nearby anyway.
@@ -1537,6 +1541,7 @@ static std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> requirements_map(
     // a vector of every item in every tile that matches any part of the requirements.
     // will be filtered for amounts/charges afterwards.
     for( const tripoint_bub_ms &point_elem : pickup_task ? loot_spots : combined_spots ) {
+        const bool already_there = already_there_set.count( point_elem ) > 0;
         std::map<itype_id, int> temp_map;
         for( const item &stack_elem : here.i_at( point_elem ) ) {
             for( std::vector<item_comp> &elem : req_comps ) {
@@ -1545,9 +1550,7 @@ static std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> requirements_map(
                         // if its near the work site, we can remove a count from the requirements.
                         // if two "lines" of the requirement have the same component appearing again
                         // that is fine, we will choose which "line" to fulfill later, and the decrement will count towards that then.
-                        if( !pickup_task &&
-                            std::find( already_there_spots.begin(), already_there_spots.end(),
-                                       point_elem ) != already_there_spots.end() ) {
+                        if( !pickup_task && already_there ) {
                             comp_elem.count -= stack_elem.count();
                         }
                         temp_map[stack_elem.typeId()] += stack_elem.count();
@@ -1557,9 +1560,7 @@ static std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> requirements_map(
             for( std::vector<tool_comp> &elem : tool_comps ) {
                 for( tool_comp &comp_elem : elem ) {
                     if( comp_elem.type == stack_elem.typeId() ) {
-                        if( !pickup_task &&
-                            std::find( already_there_spots.begin(), already_there_spots.end(),
-                                       point_elem ) != already_there_spots.end() ) {
+                        if( !pickup_task && already_there ) {
                             comp_elem.count -= stack_elem.count();
                         }
                         if( comp_elem.by_charges() ) {
@@ -1580,9 +1581,7 @@ static std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> requirements_map(
                     const quality_id tool_qual = comp_elem.type;
                     const int qual_level = comp_elem.level;
                     if( stack_elem.has_quality( tool_qual, qual_level ) ) {
-                        if( !pickup_task &&
-                            std::find( already_there_spots.begin(), already_there_spots.end(),
-                                       point_elem ) != already_there_spots.end() ) {
+                        if( !pickup_task && already_there ) {
                             comp_elem.count -= stack_elem.count();
                         }
                         temp_map[stack_elem.typeId()] += stack_elem.count();
@@ -1596,8 +1595,7 @@ static std::vector<std::tuple<tripoint_bub_ms, itype_id, int>> requirements_map(
             // we don't need to fetch those, they will be used automatically in the construction.
             // a shovel for tilling, for example, however, needs to be picked up, no matter if its near the spot or not.
             if( !pickup_task ) {
-                if( std::find( already_there_spots.begin(), already_there_spots.end(),
-                               point_elem ) != already_there_spots.end() ) {
+                if( already_there ) {
                     continue;
                 }
             }
@@ -2198,6 +2196,45 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             unload_always |= options.unload_always();
         }
 
+        const bool unload_here = mgr.has_near( zone_type_UNLOAD_ALL, abspos, 1, _fac_id( you ) );
+        const bool strip_here = mgr.has_near( zone_type_STRIP_CORPSES, abspos, 1, _fac_id( you ) );
+
+        // Destination tiles nearest to the source first, which also makes moving there cheapest.
+        // Zone types other than custom loot zones do not depend on the item, so their tiles are
+        // looked up once for all items of this tile.
+        std::unordered_map<zone_type_id, std::vector<tripoint_abs_ms>> sorted_dests;
+        std::vector<tripoint_abs_ms> item_dests;
+        const auto dests_for = [&]( const zone_type_id & id,
+        const item & it ) -> const std::vector<tripoint_abs_ms> & {
+            if( id == zone_type_LOOT_CUSTOM || id == zone_type_LOOT_ITEM_GROUP ) {
+                item_dests = get_sorted_tiles_by_distance( src, mgr.get_near( id, abspos,
+                             ACTIVITY_SEARCH_DISTANCE, &it, _fac_id( you ) ) );
+                return item_dests;
+            }
+            auto found = sorted_dests.find( id );
+            if( found == sorted_dests.end() ) {
+                const std::unordered_set<tripoint_abs_ms> dests = mgr.get_near( id, abspos,
+                        ACTIVITY_SEARCH_DISTANCE, nullptr, _fac_id( you ) );
+                found = sorted_dests.emplace( id, get_sorted_tiles_by_distance( src, dests ) ).first;
+            }
+            return found->second;
+        };
+        // Free space of the destination tiles looked at so far, updated as items are moved there
+        std::unordered_map<tripoint_abs_ms, units::volume> free_space_at;
+        const auto free_space_of = [&]( const tripoint_abs_ms & dest ) -> units::volume & {
+            auto found = free_space_at.find( dest );
+            if( found == free_space_at.end() ) {
+                const tripoint_bub_ms dest_loc = here.bub_from_abs( dest );
+                //Check destination for cargo part
+                if( const std::optional<vpart_reference> ovp = here.veh_at( dest_loc ).cargo() ) {
+                    found = free_space_at.emplace( dest, ovp->items().free_volume() ).first;
+                } else {
+                    found = free_space_at.emplace( dest, here.free_volume( dest_loc ) ).first;
+                }
+            }
+            return found->second;
+        };
+
         //Skip items that have already been processed
         for( auto it = items.begin() + num_processed; it < items.end(); ++it ) {
             ++num_processed;
@@ -2235,8 +2272,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
                 continue;
             }
 
-            const std::unordered_set<tripoint_abs_ms> dest_set =
-                mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem, _fac_id( you ) );
+            const std::vector<tripoint_abs_ms> &dest_set = dests_for( id, thisitem );
 
             // if this item isn't going anywhere and its not sealed
             // check if it is in a unload zone or a strip corpse zone
@@ -2244,8 +2280,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             bool move_and_reset = false;
             bool moved_something = false;
 
-            if( mgr.has_near( zone_type_UNLOAD_ALL, abspos, 1, _fac_id( you ) ) ||
-                ( mgr.has_near( zone_type_STRIP_CORPSES, abspos, 1, _fac_id( you ) ) && it->first->is_corpse() ) ) {
+            if( unload_here || ( strip_here && it->first->is_corpse() ) ) {
                 if( dest_set.empty() || unload_always ) {
                     if( you.rate_action_unload( *it->first ) == hint_rating::good &&
                         !it->first->any_pockets_sealed() ) {
@@ -2342,14 +2377,6 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
 
             for( const tripoint_abs_ms &dest : dest_set ) {
                 const tripoint_bub_ms dest_loc = here.bub_from_abs( dest );
-                units::volume free_space;
-
-                //Check destination for cargo part
-                if( const std::optional<vpart_reference> ovp = here.veh_at( dest_loc ).cargo() ) {
-                    free_space = ovp->items().free_volume();
-                } else {
-                    free_space = here.free_volume( dest_loc );
-                }
 
                 // skip tiles with inaccessible furniture, like filled charcoal kiln
                 if( !here.can_put_items_ter_furn( dest_loc ) ||
@@ -2358,8 +2385,11 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
                 }
 
                 // check free space at destination
-                if( free_space >= thisitem.volume() ) {
+                units::volume &free_space = free_space_of( dest );
+                const units::volume item_volume = thisitem.volume();
+                if( free_space >= item_volume ) {
                     move_item( you, thisitem, thisitem.count(), src_loc, dest_loc, vpr_src );
+                    free_space -= item_volume;
 
                     // moved item away from source so decrement
                     if( num_processed > 0 ) {
@@ -2644,6 +2674,19 @@ static std::unordered_set<tripoint_abs_ms> generic_multi_activity_locations(
     if( MOP_ACTIVITY ) {
         dark_capable = true;
     }
+    //  Exclude activities that can't have multiple characters working on the same tile.
+    const bool exclusive = act_id == ACT_MULTIPLE_CHOP_TREES ||
+                           act_id == ACT_MULTIPLE_CONSTRUCTION ||
+                           act_id == ACT_MULTIPLE_MINE;
+    // Tiles other NPCs are working on, gathered once instead of for every candidate tile
+    std::unordered_set<tripoint_abs_ms> claimed;
+    if( exclusive ) {
+        for( const npc &guy : g->all_npcs() ) {
+            if( &guy != &you && guy.has_player_activity() ) {
+                claimed.insert( tripoint_abs_ms( guy.activity.placement ) );
+            }
+        }
+    }
 
     for( auto it2 = src_set.begin(); it2 != src_set.end(); ) {
         // remove dangerous tiles
@@ -2671,30 +2714,11 @@ static std::unordered_set<tripoint_abs_ms> generic_multi_activity_locations(
             } else {
                 ++it2;
             }
-        } else //  Exclude activities that can't have multiple characters working on the same tile.
-            if( act_id == ACT_MULTIPLE_CHOP_TREES ||
-                act_id == ACT_MULTIPLE_CONSTRUCTION ||
-                act_id == ACT_MULTIPLE_MINE ) {
-                bool skip = false;
-
-                for( const npc &guy : g->all_npcs() ) {
-                    if( &guy == &you ) {
-                        continue;
-                    }
-                    if( guy.has_player_activity() && tripoint_abs_ms( guy.activity.placement ) == *it2 ) {
-                        it2 = src_set.erase( it2 );
-                        skip = true;
-                        break;
-                    }
-                }
-                if( skip ) {
-                    continue;
-                } else {
-                    ++it2;
-                }
-            } else {
-                ++it2;
-            }
+        } else if( exclusive && claimed.count( *it2 ) ) {
+            it2 = src_set.erase( it2 );
+        } else {
+            ++it2;
+        }
     }
     const bool post_dark_check = src_set.empty();
     if( !pre_dark_check && post_dark_check && !MOP_ACTIVITY ) {
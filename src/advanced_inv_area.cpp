@@ -276,11 +276,11 @@ advanced_inv_area::itemstack advanced_inv_area::i_stacked( T items )
 {
     //create a new container for our stacked items
     advanced_inv_area::itemstack stacks;
-    // used to recall indices we stored `itype_id' item at in itemstack
-    std::unordered_map<itype_id, std::set<int>> cache;
+    // used to recall indices we stored items with a given item::stacking_hash at in itemstack
+    std::unordered_map<std::size_t, std::set<int>> cache;
     // iterate through and create stacks
     for( item &elem : items ) {
-        const itype_id id = elem.typeId();
+        const std::size_t id = elem.stacking_hash();
         auto iter = cache.find( id );
         bool got_stacked = false;
         // cache entry exists
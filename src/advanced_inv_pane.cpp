@@ -1,10 +1,11 @@
 #include "advanced_inv_pane.h"
 
+#include <algorithm>
 #include <cstddef>
-#include <iterator>
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "advanced_inv_area.h"
@@ -115,20 +116,23 @@ bool advanced_inventory_pane::is_filtered( const item &it ) const
 
 /** converts a raw list of items to "stacks" - items that are not count_by_charges that otherwise stack go into one stack */
 static std::vector<std::vector<item_location>> item_list_to_stack(
-            const item_location &parent, std::list<item *> item_list )
+            const item_location &parent, const std::list<item *> &item_list )
 {
     std::vector<std::vector<item_location>> ret;
-    for( auto iter_outer = item_list.begin(); iter_outer != item_list.end(); ++iter_outer ) {
-        std::vector<item_location> item_stack( { item_location( parent, *iter_outer ) } );
-        for( auto iter_inner = std::next( iter_outer ); iter_inner != item_list.end(); ) {
-            if( ( *iter_outer )->display_stacked_with( **iter_inner ) ) {
-                item_stack.emplace_back( parent, *iter_inner );
-                iter_inner = item_list.erase( iter_inner );
-            } else {
-                ++iter_inner;
-            }
+    // indices into ret of the stacks whose items have a given item::stacking_hash
+    std::unordered_map<std::size_t, std::vector<std::size_t>> stacks_by_hash;
+    for( item *it : item_list ) {
+        std::vector<std::size_t> &candidates = stacks_by_hash[it->stacking_hash()];
+        const auto found = std::find_if( candidates.begin(), candidates.end(),
+        [&ret, it]( const std::size_t idx ) {
+            return ret[idx].front()->display_stacked_with( *it );
+        } );
+        if( found == candidates.end() ) {
+            candidates.push_back( ret.size() );
+            ret.push_back( { item_location( parent, it ) } );
+        } else {
+            ret[*found].emplace_back( parent, it );
         }
-        ret.push_back( item_stack );
     }
     return ret;
 }
@@ -733,17 +733,68 @@ void basecamp::form_storage_zones( map &here, const tripoint_abs_ms &abspos )
     set_liquid_dumping_spot( possible_liquid_dumps );
 
 }
+
+static constexpr time_duration camp_storage_lifetime = 1_minutes;
+
+// Vehicle batteries and tanks change without bumping the map revision, so a scan that includes
+// a vehicle can't be reused.
+static bool vehicles_on_tiles( const map &target_map,
+                               const std::unordered_set<tripoint_abs_ms> &tiles )
+{
+    return std::any_of( tiles.begin(), tiles.end(), [&target_map]( const tripoint_abs_ms & p ) {
+        return target_map.veh_at( p ).has_value();
+    } );
+}
+
+const basecamp::storage_cache_type &basecamp::storage_contents( map &target_map )
+{
+    // Copies of the stored items don't follow slow changes like rotting, so the scan is also
+    // redone once it gets old.
+    if( storage_cache.valid
+        && storage_cache.revision == map::items_revision()
+        && storage_cache.source == &target_map
+        && storage_cache.abs_sub == target_map.get_abs_sub()
+        && storage_cache.fuel_types == fuel_types
+        && calendar::turn >= storage_cache.time
+        && calendar::turn - storage_cache.time < camp_storage_lifetime
+        && !vehicles_on_tiles( target_map, src_set ) ) {
+        return storage_cache;
+    }
+    storage_cache.items.clear();
+    if( !src_set.empty() ) {
+        storage_cache.items.form_from_zone( target_map, src_set, nullptr, false );
+    }
+    storage_cache.fuel_charges.clear();
+    if( !fuel_types.empty() ) {
+        for( const tripoint_abs_ms &abs_ms_pt : src_set ) {
+            const tripoint_bub_ms &pt = target_map.bub_from_abs( abs_ms_pt );
+            if( target_map.accessible_items( pt ) ) {
+                for( const item &i : target_map.i_at( pt ) ) {
+                    if( fuel_types.count( i.typeId() ) ) {
+                        storage_cache.fuel_charges[i.typeId()] += i.charges;
+                    }
+                }
+            }
+        }
+    }
+    storage_cache.valid = true;
+    storage_cache.revision = map::items_revision();
+    storage_cache.time = calendar::turn;
+    storage_cache.source = &target_map;
+    storage_cache.abs_sub = target_map.get_abs_sub();
+    storage_cache.fuel_types = fuel_types;
+    return storage_cache;
+}
+
 void basecamp::form_crafting_inventory( map &target_map )
 {
-    _inv.clear();
     zone_manager &mgr = zone_manager::get_manager();
     map &here = get_map();
     if( here.check_vehicle_zones( here.get_abs_sub().z() ) ) {
         mgr.cache_vzones();
     }
-    if( !src_set.empty() ) {
-        _inv.form_from_zone( target_map, src_set, nullptr, false );
-    }
+    const storage_cache_type &storage = storage_contents( target_map );
+    _inv = storage.items;
     /*
      * something of a hack: add the resources we know the camp has
      * the hacky part is that we're adding resources based on the camp's flags, which were
@@ -755,24 +806,11 @@ void basecamp::form_crafting_inventory( map &target_map )
     for( const itype_id &fuel_id : fuel_types ) {
         basecamp_fuel bcp_f;
         bcp_f.ammo_id = fuel_id;
-        fuels.emplace_back( bcp_f );
-    }
-
-    // find available fuel
-
-    for( const tripoint_abs_ms &abs_ms_pt : src_set ) {
-        const tripoint_bub_ms &pt = target_map.bub_from_abs( abs_ms_pt );
-        if( target_map.accessible_items( pt ) ) {
-            for( const item &i : target_map.i_at( pt ) ) {
-                for( basecamp_fuel &bcp_f : fuels ) {
-                    if( bcp_f.ammo_id == i.typeId() ) {
-                        bcp_f.available += i.charges;
-                        break;
-                    }
-                }
-            }
+        const auto found = storage.fuel_charges.find( fuel_id );
+        if( found != storage.fuel_charges.end() ) {
+            bcp_f.available = found->second;
         }
-
+        fuels.emplace_back( bcp_f );
     }
     for( basecamp_resource &bcp_r : resources ) {
         bcp_r.consumed = 0;
@@ -830,6 +868,9 @@ map &basecamp::get_camp_map()
 void basecamp::unload_camp_map()
 {
     if( camp_map.map_ ) {
+        if( storage_cache.source == camp_map.map_.get() ) {
+            storage_cache.valid = false;
+        }
         camp_map.map_.reset();
     }
 }
@@ -1018,7 +1059,7 @@ void basecamp_action_components::consume_components()
     map &target_map = base_.get_camp_map();
     avatar &player_character = get_avatar();
     std::vector<tripoint> src;
-    src.resize( base_.src_set.size() );
+    src.reserve( base_.src_set.size() );
     for( const tripoint_abs_ms &p : base_.src_set ) {
         src.emplace_back( target_map.bub_from_abs( p ).raw() );
     }
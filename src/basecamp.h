@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <map>
@@ -15,6 +16,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "calendar.h"
 #include "coords_fwd.h"
 #include "craft_command.h"
 #include "game_constants.h"
@@ -287,6 +289,9 @@ class basecamp
         int recipe_batch_max( const recipe &making ) const;
         void form_crafting_inventory();
         void form_crafting_inventory( map &target_map );
+        const inventory &get_crafting_inventory() const {
+            return _inv;
+        }
         std::list<item> use_charges( const itype_id &fake_id, int &quantity );
         /**
          * spawn items or corpses based on search attempts
@@ -480,6 +485,7 @@ class basecamp
         // dumping spot in absolute co-ords
         inline void set_storage_tiles( const std::unordered_set<tripoint_abs_ms> &tiles ) {
             src_set = tiles;
+            storage_cache.valid = false;
         }
         void form_storage_zones( map &here, const tripoint_abs_ms &abspos );
         map &get_camp_map();
@@ -515,6 +521,20 @@ class basecamp
         std::vector<std::vector<ui_mission_id>> temp_ui_mission_keys;   // NOLINT(cata-serialize)
         inventory _inv; // NOLINT(cata-serialize)
         bool by_radio = false; // NOLINT(cata-serialize)
+
+        // Items and fuel found on the storage tiles, kept while map::items_revision() is unchanged.
+        struct storage_cache_type {
+            bool valid = false; // other fields are only valid if this flag is true
+            std::uint64_t revision;
+            time_point time;
+            const map *source = nullptr;
+            tripoint_abs_sm abs_sub;
+            std::set<itype_id> fuel_types;
+            inventory items;
+            std::map<itype_id, int> fuel_charges;
+        };
+        storage_cache_type storage_cache; // NOLINT(cata-serialize)
+        const storage_cache_type &storage_contents( map &target_map );
 };
 
 class basecamp_action_components
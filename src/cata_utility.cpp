@@ -17,6 +17,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "cached_options.h"
 #include "cata_path.h"
@@ -94,11 +95,17 @@ bool lcmatch( const std::string_view str, const std::string_view qry )
     if( qry.empty() ) {
         return true;
     }
+    return lcmatch( str, lcmatch_query( qry ) );
+}
+
+bool lcmatch( const std::string_view str, const std::u32string &u32_qry )
+{
+    if( u32_qry.empty() ) {
+        return true;
+    }
 
     std::u32string u32_str = utf8_to_utf32( str );
-    std::u32string u32_qry = utf8_to_utf32( qry );
     std::for_each( u32_str.begin(), u32_str.end(), u32_to_lowercase );
-    std::for_each( u32_qry.begin(), u32_qry.end(), u32_to_lowercase );
     // First try match their lowercase forms
     if( u32_str.find( u32_qry ) != std::u32string::npos ) {
         return true;
@@ -120,6 +127,38 @@ bool lcmatch( const translation &str, const std::string_view qry )
     return lcmatch( str.translated(), qry );
 }
 
+lcmatch_text::lcmatch_text( const std::string_view str ) : lowercase( utf8_to_utf32( str ) )
+{
+    std::for_each( lowercase.begin(), lowercase.end(), u32_to_lowercase );
+    std::u32string stripped = lowercase;
+    std::for_each( stripped.begin(), stripped.end(), remove_accent );
+    if( stripped != lowercase ) {
+        unaccented = std::move( stripped );
+    }
+}
+
+bool lcmatch_text::matches( const std::u32string &qry ) const
+{
+    if( qry.empty() || lowercase.find( qry ) != std::u32string::npos ) {
+        return true;
+    }
+    const std::u32string &stripped = unaccented.empty() ? lowercase : unaccented;
+    if( !unaccented.empty() && unaccented.find( qry ) != std::u32string::npos ) {
+        return true;
+    }
+    if( use_pinyin_search ) {
+        return pinyin::pinyin_match( stripped, qry );
+    }
+    return false;
+}
+
+std::u32string lcmatch_query( const std::string_view qry )
+{
+    std::u32string u32_qry = utf8_to_utf32( qry );
+    std::for_each( u32_qry.begin(), u32_qry.end(), u32_to_lowercase );
+    return u32_qry;
+}
+
 bool match_include_exclude( const std::string_view text, std::string filter )
 {
     size_t iPos;
@@ -111,6 +111,36 @@ bool isBetween( int test, int down, int up );
  */
 bool lcmatch( std::string_view str, std::string_view qry );
 bool lcmatch( const translation &str, std::string_view qry );
+/**
+ * Same as above, for a query string converted once with lcmatch_query() and then
+ * tested against many subjects.
+ */
+bool lcmatch( std::string_view str, const std::u32string &qry );
+
+/**
+ * Subject string of lcmatch() converted ahead of time, for text that is searched
+ * over and over (menus filtering the same entries on every keystroke).
+ */
+class lcmatch_text
+{
+    public:
+        lcmatch_text() = default;
+        explicit lcmatch_text( std::string_view str );
+
+        /**
+         * Same result as lcmatch( str, qry ).
+         * @param qry Query string as returned by lcmatch_query().
+         */
+        bool matches( const std::u32string &qry ) const;
+
+    private:
+        std::u32string lowercase;
+        // Empty when removing accents does not change the lowercase form
+        std::u32string unaccented;
+};
+
+/** Query string of lcmatch() in the form lcmatch_text::matches() expects. */
+std::u32string lcmatch_query( std::string_view qry );
 
 /**
  * Matches text case insensitive with the include/exclude rules of the filter
@@ -56,6 +56,7 @@
 #include "game_constants.h"
 #include "gun_mode.h"
 #include "handle_liquid.h"
+#include "hash_utils.h"
 #include "input_context.h"
 #include "input_enums.h"
 #include "inventory.h"
@@ -1525,6 +1526,7 @@ bool Character::can_stash( const item &it, bool ignore_pkt_settings )
 bool Character::can_stash( const item &it, int &copies_remaining, bool ignore_pkt_settings )
 {
     bool stashed_any = false;
+    item_pocket::totals_cache_scope totals_cache;
 
     for( item_location loc : top_items_loc() ) {
         if( loc->can_contain( it, copies_remaining, false, false, ignore_pkt_settings ).success() ) {
@@ -7681,7 +7683,89 @@ void Character::recalculate_bodyparts()
                    get_cached_organic_size() );
 }
 
+std::optional<std::size_t> Character::enchantment_sources_signature() const
+{
+    std::size_t seed = 0;
+    bool depends_on_dialogue = false;
+    const auto add_item = [&]( const item & it ) {
+        // The address alone is not enough: the wielded item always lives in the same place
+        // and items can be transformed in place, so the enchantments themselves are hashed too.
+        for( const enchant_cache &ench : it.get_proc_enchantments() ) {
+            depends_on_dialogue |= ench.depends_on_dialogue();
+            cata::hash_combine( seed, ench.hash() );
+        }
+        for( const enchantment &ench : it.get_defined_enchantments() ) {
+            depends_on_dialogue |= ench.depends_on_dialogue();
+            cata::hash_combine( seed, ench.id );
+        }
+        cata::hash_combine( seed, it.typeId() );
+        cata::hash_combine( seed, &it );
+        cata::hash_combine( seed, it.active );
+        cata::hash_combine( seed, is_wielding( it ) );
+        cata::hash_combine( seed, is_worn( it ) || is_worn_module( it ) );
+    };
+    for( const std::list<item> *stack : inv->const_slice() ) {
+        for( const item &it : *stack ) {
+            if( it.is_relic() ) {
+                add_item( it );
+            }
+        }
+    }
+    cache_visit_items_with( "is_relic", &item::is_relic, add_item );
+
+    for( const std::pair<const trait_id, trait_data> &mut_map : my_mutations ) {
+        const mutation_branch &mut = mut_map.first.obj();
+        if( mut.enchantments.empty() ) {
+            continue;
+        }
+        for( const enchantment_id &ench_id : mut.enchantments ) {
+            depends_on_dialogue |= ench_id->depends_on_dialogue();
+        }
+        cata::hash_combine( seed, mut_map.first );
+        cata::hash_combine( seed, mut_map.second.powered );
+    }
+    for( const bionic &bio : *my_bionics ) {
+        if( bio.id->enchantments.empty() ) {
+            continue;
+        }
+        for( const enchantment_id &ench_id : bio.id->enchantments ) {
+            depends_on_dialogue |= ench_id->depends_on_dialogue();
+        }
+        cata::hash_combine( seed, bio.id );
+        cata::hash_combine( seed, bio.powered );
+    }
+    for( const auto &elem : *effects ) {
+        if( elem.first->enchantments.empty() ) {
+            continue;
+        }
+        for( const enchantment_id &ench_id : elem.first->enchantments ) {
+            depends_on_dialogue |= ench_id->depends_on_dialogue();
+        }
+        cata::hash_combine( seed, elem.first );
+    }
+
+    if( depends_on_dialogue ) {
+        return std::nullopt;
+    }
+    return seed;
+}
+
 void Character::recalculate_enchantment_cache()
+{
+    // Only rebuild the cache when a source of enchantments changed since it was last built.
+    const std::optional<std::size_t> sources = enchantment_sources_signature();
+    if( !sources || sources != enchantment_cache_sources ) {
+        enchantment_cache_sources = sources;
+        rebuild_enchantment_cache();
+    }
+
+    if( enchantment_cache->modifies_bodyparts() ) {
+        recalculate_bodyparts();
+    }
+    recalc_hp();
+}
+
+void Character::rebuild_enchantment_cache()
 {
     // start by resetting the cache to all inventory items
     *enchantment_cache = inv->get_active_enchantment_cache( *this );
@@ -7731,11 +7815,6 @@ void Character::recalculate_enchantment_cache()
             }
         }
     }
-
-    if( enchantment_cache->modifies_bodyparts() ) {
-        recalculate_bodyparts();
-    }
-    recalc_hp();
 }
 
 double Character::calculate_by_enchantment( double modify, enchant_vals::mod value,
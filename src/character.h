@@ -1559,6 +1559,17 @@ class Character : public Creature, public visitable
         void recalculate_bodyparts();
         // recalculates enchantment cache by iterating through all held, worn, and wielded items
         void recalculate_enchantment_cache();
+    private:
+        /**
+         * Hash of the state of everything that can grant this character an enchantment:
+         * relics and whether they are worn, wielded or active, mutations, bionics and effects.
+         * Empty if any of those enchantments depends on dialogue state and must be
+         * re-evaluated regardless.
+         */
+        std::optional<std::size_t> enchantment_sources_signature() const;
+        // rebuilds enchantment cache from all sources, see recalculate_enchantment_cache
+        void rebuild_enchantment_cache();
+    public:
         // gets add and mult value from enchantment cache
         double calculate_by_enchantment( double modify, enchant_vals::mod value,
                                          bool round_output = false ) const;
@@ -4128,7 +4139,13 @@ class Character : public Creature, public visitable
             int moves;
             tripoint position;
             int radius;
+            bool clear_path;
             pimpl<inventory> crafting_inventory;
+            // Items within radius of position, kept while map::items_revision() is unchanged.
+            bool nearby_valid = false; // the fields below are only valid if this flag is true
+            std::uint64_t nearby_revision;
+            time_point nearby_time;
+            pimpl<inventory> nearby_inventory;
         };
         mutable crafting_cache_type crafting_cache;
 
@@ -4164,8 +4181,10 @@ class Character : public Creature, public visitable
         mutable bool last_climate_control_ret;
 
         // a cache of all active enchantment values.
-        // is recalculated every turn in Character::recalculate_enchantment_cache
+        // is recalculated in Character::recalculate_enchantment_cache whenever its sources changed
         pimpl<enchant_cache> enchantment_cache;
+        // enchantment_sources_signature() of the sources enchantment_cache was built from
+        std::optional<std::size_t> enchantment_cache_sources; // NOLINT(cata-serialize)
 
     private:
         /* cached recipes, which are invalidated if the turn changes */
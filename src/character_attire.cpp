@@ -2463,7 +2463,12 @@ void outfit::add_stash( Character &guy, const item &newit, int &remaining_charge
         &sort_f = [&temp_it]( const pocket_data_with_parent & a, const pocket_data_with_parent & b ) {
             return b.pocket_ptr->better_pocket( *a.pocket_ptr, temp_it, false );
         };
-        pockets_with_parent = guy.get_all_pocket_with_parent( pocket_filter, &sort_f );
+        {
+            // Pockets are ranked once for the whole batch of charges. Contents don't change
+            // until they're filled below, so don't re-sum them for every comparison of the sort.
+            item_pocket::totals_cache_scope totals_cache;
+            pockets_with_parent = guy.get_all_pocket_with_parent( pocket_filter, &sort_f );
+        }
 
         const int amount = remaining_charges;
         int num_contained = 0;
@@ -185,6 +185,7 @@ units::volume Character::max_single_item_volume() const
 std::pair<item_location, item_pocket *> Character::best_pocket( const item &it, const item *avoid,
         bool ignore_settings )
 {
+    item_pocket::totals_cache_scope totals_cache;
     item_location weapon_loc( *this, &weapon );
     std::pair<item_location, item_pocket *> ret = std::make_pair( item_location(), nullptr );
     if( &weapon != &it && &weapon != avoid ) {
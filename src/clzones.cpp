@@ -109,6 +109,8 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    area_bounds_cache.clear();
+    vzone_bounds_cache.clear();
 }
 
 std::string zone_type::name() const
@@ -859,6 +861,7 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    area_bounds_cache.clear();
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.get_location();
     for( zone_data &elem : zones ) {
@@ -874,6 +877,7 @@ void zone_manager::cache_data( bool update_avatar )
 
         const std::string &type_hash = elem.get_type_hash();
         auto &cache = area_cache[type_hash];
+        area_bounds_cache[type_hash].emplace_back( elem.get_start_point(), elem.get_end_point() );
 
         // Draw marked area
         for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
@@ -914,6 +918,7 @@ void zone_manager::cache_avatar_location()
 void zone_manager::cache_vzones( map *pmap )
 {
     vzone_cache.clear();
+    vzone_bounds_cache.clear();
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -923,6 +928,8 @@ void zone_manager::cache_vzones( map *pmap )
 
         const std::string &type_hash = elem->get_type_hash();
         auto &cache = vzone_cache[type_hash];
+        vzone_bounds_cache[type_hash].emplace_back( elem->get_start_point(),
+                elem->get_end_point() );
 
         // TODO: looks very similar to the above cache_data - maybe merge it?
 
@@ -934,12 +941,46 @@ void zone_manager::cache_vzones( map *pmap )
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
+static const std::unordered_set<tripoint_abs_ms> &no_points()
+{
+    static const std::unordered_set<tripoint_abs_ms> empty;
+    return empty;
+}
+
+static const std::vector<inclusive_cuboid<tripoint_abs_ms>> &no_bounds()
+{
+    static const std::vector<inclusive_cuboid<tripoint_abs_ms>> empty;
+    return empty;
+}
+
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_points();
+    }
+
+    return type_iter->second;
+}
+
+const std::vector<inclusive_cuboid<tripoint_abs_ms>> &zone_manager::get_bounds(
+    const zone_type_id &type, const faction_id &fac ) const
+{
+    const auto &type_iter = area_bounds_cache.find( zone_data::make_type_hash( type, fac ) );
+    if( type_iter == area_bounds_cache.end() ) {
+        return no_bounds();
+    }
+
+    return type_iter->second;
+}
+
+const std::vector<inclusive_cuboid<tripoint_abs_ms>> &zone_manager::get_vzone_bounds(
+    const zone_type_id &type, const faction_id &fac ) const
+{
+    const auto &type_iter = vzone_bounds_cache.find( zone_data::make_type_hash( type, fac ) );
+    if( type_iter == vzone_bounds_cache.end() ) {
+        return no_bounds();
     }
 
     return type_iter->second;
@@ -956,7 +997,7 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
 {
     std::unordered_set<tripoint> res;
     map &here = get_map();
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : area_cache ) {
+    for( const auto &cache : area_cache ) {
         zone_type_id type = zone_data::unhash_type( cache.first );
         faction_id z_fac = zone_data::unhash_fac( cache.first );
         if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
@@ -967,7 +1008,7 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
             }
         }
     }
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+    for( const auto &cache : vzone_cache ) {
         zone_type_id type = zone_data::unhash_type( cache.first );
         faction_id z_fac = zone_data::unhash_fac( cache.first );
         if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
@@ -980,7 +1021,7 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     }
 
     if( npc_search ) {
-        for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+        for( const auto &cache : vzone_cache ) {
             zone_type_id type = zone_data::unhash_type( cache.first );
             if( type == zone_type_NO_NPC_PICKUP ) {
                 for( tripoint_abs_ms point : cache.second ) {
@@ -993,13 +1034,13 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_points();
     }
 
     return type_iter->second;
@@ -1013,26 +1054,28 @@ bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
     return point_set.find( where ) != point_set.end() || vzone_set.find( where ) != vzone_set.end();
 }
 
+// Vehicle zones only count on the z-level of the point they are searched from
+static bool covers_z( const inclusive_cuboid<tripoint_abs_ms> &bounds, int z )
+{
+    return bounds.p_min.z() <= z && z <= bounds.p_max.z();
+}
+
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            return true;
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
-        }
+    const auto in_range = [&where, range]( const inclusive_cuboid<tripoint_abs_ms> &bounds ) {
+        return square_dist( clamp( where, bounds ), where ) <= range;
+    };
+    const auto &bounds = get_bounds( type, fac );
+    if( std::any_of( bounds.begin(), bounds.end(), in_range ) ) {
+        return true;
     }
 
-    return false;
+    const auto &vzone_bounds = get_vzone_bounds( type, fac );
+    return std::any_of( vzone_bounds.begin(), vzone_bounds.end(),
+    [&]( const inclusive_cuboid<tripoint_abs_ms> &b ) {
+        return covers_z( b, where.z() ) && in_range( b );
+    } );
 }
 
 std::vector<zone_data const *> zone_manager::get_near_zones( const zone_type_id &type,
@@ -1106,6 +1149,26 @@ std::vector<zone_data const *> zone_manager::get_zones_at( const tripoint_abs_ms
     return ret;
 }
 
+// whether a LOOT_CUSTOM or LOOT_ITEM_GROUP zone accepts the item
+static bool custom_loot_accepts( const zone_data &zone, const item &it,
+                                 const zone_type_id &ztype )
+{
+    item const *const check_it = it.this_or_single_content();
+    loot_options const &options = dynamic_cast<const loot_options &>( zone.get_options() );
+    std::string const filter_string = options.get_mark();
+    if( ztype == zone_type_LOOT_CUSTOM ) {
+        auto const z = item_filter_from_string( filter_string );
+        return z( *check_it ) || ( check_it != &it && z( it ) );
+    } else if( ztype == zone_type_LOOT_ITEM_GROUP ) {
+        return item_group::group_contains_item( item_group_id( filter_string ),
+                                                check_it->typeId() ) ||
+               ( check_it != &it &&
+                 item_group::group_contains_item( item_group_id( filter_string ),
+                         it.typeId() ) );
+    }
+    return false;
+}
+
 bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it,
                                     const zone_type_id &ztype, const faction_id &fac ) const
 {
@@ -1113,54 +1176,72 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
     if( zones.empty() || !it ) {
         return false;
     }
-    item const *const check_it = it->this_or_single_content();
-    for( zone_data const *zone : zones ) {
-        loot_options const &options = dynamic_cast<const loot_options &>( zone->get_options() );
-        std::string const filter_string = options.get_mark();
-        bool has = false;
-        if( ztype == zone_type_LOOT_CUSTOM ) {
-            auto const z = item_filter_from_string( filter_string );
-            has = z( *check_it ) || ( check_it != it && z( *it ) );
-        } else if( ztype == zone_type_LOOT_ITEM_GROUP ) {
-            has = item_group::group_contains_item( item_group_id( filter_string ),
-                                                   check_it->typeId() ) ||
-                  ( check_it != it &&
-                    item_group::group_contains_item( item_group_id( filter_string ),
-                            it->typeId() ) );
-        }
-        if( has ) {
-            return true;
-        }
-    }
-
-    return false;
+    return std::any_of( zones.begin(), zones.end(), [it, &ztype]( zone_data const * zone ) {
+        return custom_loot_accepts( *zone, *it, ztype );
+    } );
 }
 
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     std::unordered_set<tripoint_abs_ms> near_point_set;
+    if( range < 0 ) {
+        return near_point_set;
+    }
 
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                near_point_set.insert( point );
+    // For custom loot zones, find the zones that accept the item once rather than for each point
+    const bool custom = type == zone_type_LOOT_CUSTOM || type == zone_type_LOOT_ITEM_GROUP;
+    std::vector<zone_data const *> accepting;
+    if( custom ) {
+        if( it == nullptr ) {
+            return near_point_set;
+        }
+        for( const zone_data &zone : zones ) {
+            if( zone.get_type() == type && zone.get_faction() == fac &&
+                custom_loot_accepts( zone, *it, type ) ) {
+                accepting.emplace_back( &zone );
             }
         }
+        map &here = get_map();
+        for( const zone_data *zone : here.get_vehicle_zones( here.get_abs_sub().z() ) ) {
+            if( zone->get_type() == type && zone->get_faction() == fac &&
+                custom_loot_accepts( *zone, *it, type ) ) {
+                accepting.emplace_back( zone );
+            }
+        }
+        if( accepting.empty() ) {
+            return near_point_set;
+        }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                    ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                    near_point_set.insert( point );
-                }
+    // Only the points of each zone that are within range are visited
+    const auto add_points = [&]( const inclusive_cuboid<tripoint_abs_ms> &bounds, int min_z,
+    int max_z ) {
+        const tripoint_abs_ms from( std::max( bounds.p_min.x(), where.x() - range ),
+                                    std::max( bounds.p_min.y(), where.y() - range ),
+                                    std::max( bounds.p_min.z(), min_z ) );
+        const tripoint_abs_ms to( std::min( bounds.p_max.x(), where.x() + range ),
+                                  std::min( bounds.p_max.y(), where.y() + range ),
+                                  std::min( bounds.p_max.z(), max_z ) );
+        if( from.x() > to.x() || from.y() > to.y() || from.z() > to.z() ) {
+            return;
+        }
+        for( const tripoint_abs_ms &point : tripoint_range<tripoint_abs_ms>( from, to ) ) {
+            if( !custom || std::any_of( accepting.begin(), accepting.end(),
+            [&point]( zone_data const * zone ) {
+            return zone->has_inside( point );
+            } ) ) {
+                near_point_set.insert( point );
             }
         }
+    };
+
+    for( const inclusive_cuboid<tripoint_abs_ms> &bounds : get_bounds( type, fac ) ) {
+        add_points( bounds, where.z() - range, where.z() + range );
+    }
+    // Vehicle zones only count on the z-level they are searched from
+    for( const inclusive_cuboid<tripoint_abs_ms> &bounds : get_vzone_bounds( type, fac ) ) {
+        add_points( bounds, where.z(), where.z() );
     }
 
     return near_point_set;
@@ -1175,26 +1256,19 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
     tripoint_abs_ms nearest_pos( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint_abs_ms> &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
-    }
-
-    const std::unordered_set<tripoint_abs_ms> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    // The nearest point of a zone is the searched point clamped into its area
+    for( const auto *all_bounds : {
+             &get_bounds( type, fac ), &get_vzone_bounds( type, fac )
+         } ) {
+        for( const inclusive_cuboid<tripoint_abs_ms> &bounds : *all_bounds ) {
+            const tripoint_abs_ms p = clamp( where, bounds );
+            int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
+                if( nearest_dist == 0 ) {
+                    return nearest_pos;
+                }
             }
         }
     }
@@ -537,10 +537,20 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
+        using bounds_cache_t =
+            std::unordered_map<std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>>;
+        // Areas of the zones in area_cache and vzone_cache, so distance queries can look at
+        // each zone instead of each point
+        bounds_cache_t area_bounds_cache; // NOLINT(cata-serialize)
+        bounds_cache_t vzone_bounds_cache; // NOLINT(cata-serialize)
+        const std::unordered_set<tripoint_abs_ms> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint_abs_ms> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+        const std::vector<inclusive_cuboid<tripoint_abs_ms>> &get_bounds( const zone_type_id &type,
+                const faction_id &fac ) const;
+        const std::vector<inclusive_cuboid<tripoint_abs_ms>> &get_vzone_bounds(
+                    const zone_type_id &type, const faction_id &fac ) const;
     public:
         zone_manager();
         ~zone_manager() = default;
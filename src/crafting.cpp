@@ -125,6 +125,18 @@ static const std::string flag_NO_ENCHANTMENT( "NO_ENCHANTMENT" );
 static const std::string flag_NO_MANIP( "NO_MANIP" );
 static const std::string flag_NO_RESIZE( "NO_RESIZE" );
 
+// How long a scan of the items around a crafter is trusted while the map reports no changes
+static constexpr time_duration crafting_nearby_lifetime = 1_minutes;
+
+// Vehicle batteries, tanks and faucets provide charges that change without bumping the map
+// revision, so a scan that may include a vehicle can't be reused.
+static bool vehicles_in_radius( const tripoint &pos, int radius )
+{
+    const tripoint_bub_ms center( pos );
+    const tripoint offset( radius, radius, 0 );
+    return !get_map().get_vehicles( center - offset, center + offset ).empty();
+}
+
 class basecamp;
 
 static bool crafting_allowed( const Character &p, const recipe &rec )
@@ -664,18 +676,36 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     if( src_pos == tripoint_zero ) {
         inv_pos = pos();
     }
+    const bool same_area = radius == crafting_cache.radius
+                           && inv_pos == crafting_cache.position
+                           && clear_path == crafting_cache.clear_path;
     if( crafting_cache.valid
+        && same_area
         && moves == crafting_cache.moves
-        && radius == crafting_cache.radius
         && calendar::turn == crafting_cache.time
-        && inv_pos == crafting_cache.position
+        && map::items_revision() == crafting_cache.nearby_revision
       ) {
         return *crafting_cache.crafting_inventory;
     }
-    crafting_cache.crafting_inventory->clear();
-    if( radius >= 0 ) {
-        crafting_cache.crafting_inventory->form_from_map( inv_pos, radius, this, false, clear_path );
+    // The items around us only need to be collected again when something on the map changed.
+    // Copies of the items found also don't follow slow changes like rotting, so the scan is
+    // redone once it gets old.
+    if( !crafting_cache.nearby_valid
+        || !same_area
+        || map::items_revision() != crafting_cache.nearby_revision
+        || ( radius >= 0 && vehicles_in_radius( inv_pos, radius ) )
+        || calendar::turn < crafting_cache.nearby_time
+        || calendar::turn - crafting_cache.nearby_time >= crafting_nearby_lifetime
+      ) {
+        crafting_cache.nearby_inventory->clear();
+        if( radius >= 0 ) {
+            crafting_cache.nearby_inventory->form_from_map( inv_pos, radius, this, false, clear_path );
+        }
+        crafting_cache.nearby_valid = true;
+        crafting_cache.nearby_revision = map::items_revision();
+        crafting_cache.nearby_time = calendar::turn;
     }
+    *crafting_cache.crafting_inventory = *crafting_cache.nearby_inventory;
 
     std::map<itype_id, int> tmp_liq_list;
     // TODO: Add a const overload of all_items_loc() that returns something like
@@ -712,6 +742,7 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     crafting_cache.time = calendar::turn;
     crafting_cache.position = inv_pos;
     crafting_cache.radius = radius;
+    crafting_cache.clear_path = clear_path;
     return *crafting_cache.crafting_inventory;
 }
 
@@ -719,6 +750,8 @@ void Character::invalidate_crafting_inventory()
 {
     crafting_cache.valid = false;
     crafting_cache.crafting_inventory->clear();
+    crafting_cache.nearby_valid = false;
+    crafting_cache.nearby_inventory->clear();
 }
 
 void Character::make_craft( const recipe_id &id_to_make, int batch_size,
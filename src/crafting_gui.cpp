@@ -227,6 +227,8 @@ struct availability {
                                         || crafter.get_knowledge_level( rec->skill_used )
                                         >= static_cast<int>( rec->get_difficulty( crafter ) * 0.8f );
             has_proficiencies = r->character_has_required_proficiencies( crafter );
+            const bool has_requirements =
+                req.can_make_with_inventory( inv, all_items_filter, batch_size, craft_flags::start_only );
             std::string reason;
             if( crafter.is_npc() && !r->npc_can_craft( reason ) ) {
                 can_craft = false;
@@ -234,12 +236,16 @@ struct availability {
                 can_craft = check_can_craft_nested( _crafter, *r );
             } else {
                 can_craft = ( !r->is_practice() || has_all_skills ) && has_proficiencies &&
-                            req.can_make_with_inventory( inv, all_items_filter, batch_size, craft_flags::start_only );
-            }
-            would_use_rotten = !req.can_make_with_inventory( inv, no_rotten_filter, batch_size,
-                               craft_flags::start_only );
-            would_use_favorite = !req.can_make_with_inventory( inv, no_favorite_filter, batch_size,
-                                 craft_flags::start_only );
+                            has_requirements;
+            }
+            // The stricter filters only ever leave fewer usable items, so there is no point
+            // checking them when all items together don't do.
+            would_use_rotten = !has_requirements ||
+                               !req.can_make_with_inventory( inv, no_rotten_filter, batch_size,
+                                       craft_flags::start_only );
+            would_use_favorite = !has_requirements ||
+                                 !req.can_make_with_inventory( inv, no_favorite_filter, batch_size,
+                                         craft_flags::start_only );
             useless_practice = r->is_practice() && cannot_gain_skill_or_prof( crafter, *r );
             is_nested_category = r->is_nested();
             const requirement_data &simple_req = r->simple_requirements();
@@ -1756,6 +1756,7 @@ void Creature::add_effect( const effect_source &source, const efftype_id &eff_id
             e.set_intensity( e.get_max_intensity() );
         }
         ( *effects )[eff_id][bp] = e;
+        effect_flags_dirty = true;
         if( Character *ch = as_character() ) {
             get_event_bus().send<event_type::character_gains_effect>( ch->getID(), bp.id(), eff_id );
             if( is_avatar() ) {
@@ -1830,6 +1831,7 @@ void Creature::clear_effects()
         }
     }
     effects->clear();
+    effect_flags_dirty = true;
 }
 bool Creature::remove_effect( const efftype_id &eff_id, const bodypart_id &bp )
 {
@@ -1863,6 +1865,7 @@ bool Creature::remove_effect( const efftype_id &eff_id, const bodypart_id &bp )
             effects->erase( eff_id );
         }
     }
+    effect_flags_dirty = true;
     return true;
 }
 bool Creature::remove_effect( const efftype_id &eff_id )
@@ -1911,10 +1914,16 @@ bool Creature::has_effect_with_flag( const flag_id &flag, const bodypart_id &bp
 
 bool Creature::has_effect_with_flag( const flag_id &flag ) const
 {
-    return std::any_of( effects->begin(), effects->end(), [&]( const auto & elem ) {
-        // effect::has_flag currently delegates to effect_type::has_flag
-        return elem.first->has_flag( flag );
-    } );
+    if( effect_flags_dirty ) {
+        effect_flags_cache.clear();
+        for( const auto &elem : *effects ) {
+            // effect::has_flag currently delegates to effect_type::has_flag
+            const std::set<flag_id> &flags = elem.first->get_flags();
+            effect_flags_cache.insert( flags.begin(), flags.end() );
+        }
+        effect_flags_dirty = false;
+    }
+    return effect_flags_cache.count( flag );
 }
 
 std::vector<std::reference_wrapper<const effect>> Creature::get_effects_with_flag(
@@ -1932,15 +1941,9 @@ std::vector<std::reference_wrapper<const effect>> Creature::get_effects_with_fla
     return effs;
 }
 
-std::vector<std::reference_wrapper<const effect>> Creature::get_effects() const
+effects_view Creature::get_effects() const
 {
-    std::vector<std::reference_wrapper<const effect>> effs;
-    for( auto &elem : *effects ) {
-        for( const std::pair<const bodypart_id, effect> &_it : elem.second ) {
-            effs.emplace_back( _it.second );
-        }
-    }
-    return effs;
+    return effects_view( *effects );
 }
 
 std::vector<std::reference_wrapper<const effect>> Creature::get_effects_from_bp(
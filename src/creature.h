@@ -26,6 +26,7 @@
 #include "debug.h"
 #include "effect_source.h"
 #include "enums.h"
+#include "flat_set.h"
 #include "pimpl.h"
 #include "point.h"
 #include "string_formatter.h"
@@ -43,6 +44,7 @@ class body_part_set;
 class character_id;
 class effect;
 class effects_map;
+class effects_view;
 class field;
 class field_entry;
 class item;
@@ -663,7 +665,8 @@ class Creature : public viewer
                     const flag_id &flag ) const;
         std::vector<std::reference_wrapper<const effect>> get_effects_from_bp(
                     const bodypart_id &bp ) const;
-        std::vector<std::reference_wrapper<const effect>> get_effects() const;
+        /** Returns a read only view over all effects, in the same order as they are stored. */
+        effects_view get_effects() const;
 
         /** Return the effect that matches the given arguments exactly. */
         const effect &get_effect( const efftype_id &eff_id,
@@ -1215,6 +1218,10 @@ class Creature : public viewer
         virtual void process_one_effect( effect &e, bool is_new ) = 0;
 
         pimpl<effects_map> effects;
+        // Union of the flags of all effect types in effects, rebuilt on demand after effects are
+        // added or removed. See has_effect_with_flag.
+        mutable cata::flat_set<flag_id> effect_flags_cache;
+        mutable bool effect_flags_dirty = true;
         std::queue<scheduled_effect, std::list<scheduled_effect>> scheduled_effects;
         std::queue<terminating_effect, std::list<terminating_effect>> terminating_effects;
 
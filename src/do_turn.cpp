@@ -26,6 +26,7 @@
 #include "cata_variant.h"
 #include "clzones.h"
 #include "coordinates.h"
+#include "cuboid_rectangle.h"
 #include "debug.h"
 #include "enums.h"
 #include "event.h"
@@ -392,17 +393,30 @@ void overmap_npc_move()
 {
     avatar &u = get_avatar();
     std::vector<npc *> travelling_npcs;
+    // NPCs that were loaded when they started moving; they must be unloaded after moving.
+    std::vector<npc *> active_travellers;
     static constexpr int move_search_radius = 600;
     for( auto &elem : overmap_buffer.get_npcs_near_player( move_search_radius ) ) {
         if( !elem ) {
             continue;
         }
         npc *npc_to_add = elem.get();
-        if( ( !npc_to_add->is_active() || rl_dist( u.pos(), npc_to_add->pos() ) > SEEX * 2 ) &&
-            npc_to_add->mission == NPC_MISSION_TRAVELLING ) {
+        if( npc_to_add->mission != NPC_MISSION_TRAVELLING ) {
+            continue;
+        }
+        const bool active = npc_to_add->is_active();
+        if( !active || rl_dist( u.pos(), npc_to_add->pos() ) > SEEX * 2 ) {
             travelling_npcs.push_back( npc_to_add );
+            if( active ) {
+                active_travellers.push_back( npc_to_add );
+            }
         }
     }
+    // Reloading NPCs unloads and reloads every NPC in the reality bubble, so only do it
+    // when a traveller actually left or entered the bubble.
+    const tripoint_abs_sm abs_sub = get_map().get_abs_sub();
+    const half_open_rectangle<point_abs_sm> map_bounds( abs_sub.xy(),
+            abs_sub.xy() + point( MAPSIZE, MAPSIZE ) );
     bool npcs_need_reload = false;
     for( npc *&elem : travelling_npcs ) {
         if( elem->has_omt_destination() ) {
@@ -422,7 +436,11 @@ void overmap_npc_move()
                 }
             } else {
                 elem->travel_overmap( elem->omt_path.back() );
-                npcs_need_reload = true;
+                if( !npcs_need_reload ) {
+                    npcs_need_reload = map_bounds.contains( elem->global_sm_location().xy() ) ||
+                                       std::find( active_travellers.begin(), active_travellers.end(),
+                                                  elem ) != active_travellers.end();
+                }
             }
         }
         if( !elem->has_omt_destination() && calendar::once_every( 1_hours ) && one_in( 3 ) ) {
@@ -466,6 +484,7 @@ bool do_turn()
 
     // starting a new turn, clear out temperature cache
     weather.temperature_cache.clear();
+    weather.weather_temperature_cache.clear();
 
     if( g->npcs_dirty ) {
         g->load_npcs();
@@ -764,6 +764,33 @@ bool effect_type::load_apply_msgs( const JsonObject &jo, const std::string_view
 
 effect effect::null_effect;
 
+effects_view::iterator::iterator( effects_map::const_iterator outer,
+                                  effects_map::const_iterator outer_end ) : outer( outer ),
+    outer_end( outer_end )
+{
+    if( outer != outer_end ) {
+        inner = outer->second.begin();
+        skip_exhausted();
+    }
+}
+
+effects_view::iterator &effects_view::iterator::operator++()
+{
+    ++inner;
+    skip_exhausted();
+    return *this;
+}
+
+void effects_view::iterator::skip_exhausted()
+{
+    while( outer != outer_end && inner == outer->second.end() ) {
+        ++outer;
+        if( outer != outer_end ) {
+            inner = outer->second.begin();
+        }
+    }
+}
+
 bool effect::is_null() const
 {
     return !eff_type;
@@ -5,6 +5,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <set>
@@ -164,6 +165,9 @@ class effect_type
 
         /** Check if the effect type has the specified flag */
         bool has_flag( const flag_id &flag ) const;
+        const std::set<flag_id> &get_flags() const {
+            return flags;
+        }
 
         const time_duration &intensity_duration() const {
             return int_dur_factor;
@@ -444,6 +448,68 @@ class effect
 
 };
 
+/**
+ * Read only view over all effects of an @ref effects_map, in storage order.
+ * Lets callers iterate every effect of a creature without collecting references first.
+ */
+class effects_view
+{
+    public:
+        class iterator
+        {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = effect;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const effect *;
+                using reference = const effect &;
+
+                iterator( effects_map::const_iterator outer, effects_map::const_iterator outer_end );
+
+                reference operator*() const {
+                    return inner->second;
+                }
+                pointer operator->() const {
+                    return &inner->second;
+                }
+                iterator &operator++();
+                iterator operator++( int ) {
+                    iterator result = *this;
+                    ++*this;
+                    return result;
+                }
+                bool operator==( const iterator &rhs ) const {
+                    return outer == rhs.outer && ( outer == outer_end || inner == rhs.inner );
+                }
+                bool operator!=( const iterator &rhs ) const {
+                    return !operator==( rhs );
+                }
+
+            private:
+                /** Advances to the next outer entry while the current bodypart map is exhausted. */
+                void skip_exhausted();
+
+                effects_map::const_iterator outer;
+                effects_map::const_iterator outer_end;
+                std::map<bodypart_id, effect>::const_iterator inner;
+        };
+
+        explicit effects_view( const effects_map &effects ) : effects( &effects ) {}
+
+        iterator begin() const {
+            return iterator( effects->begin(), effects->end() );
+        }
+        iterator end() const {
+            return iterator( effects->end(), effects->end() );
+        }
+        bool empty() const {
+            return begin() == end();
+        }
+
+    private:
+        const effects_map *effects;
+};
+
 void load_effect_type( const JsonObject &jo, std::string_view src );
 void reset_effect_types();
 const std::map<efftype_id, effect_type> &get_effect_types();
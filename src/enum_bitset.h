@@ -81,6 +81,10 @@ class enum_bitset
             return bits.none();
         }
 
+        unsigned long long to_ullong() const {
+            return bits.to_ullong();
+        }
+
         static constexpr size_t size() noexcept {
             return get_pos( enum_traits<E>::last );
         }
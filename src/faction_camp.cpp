@@ -1982,7 +1982,7 @@ npc_ptr basecamp::start_mission( const mission_id &miss_id, time_duration durati
         if( !equipment.empty() ) {
             map &target_map = get_camp_map();
             std::vector<tripoint_bub_ms> src_set_pt;
-            src_set_pt.resize( src_set.size() );
+            src_set_pt.reserve( src_set.size() );
             for( const tripoint_abs_ms &p : src_set ) {
                 src_set_pt.emplace_back( target_map.bub_from_abs( p ) );
             }
@@ -400,6 +400,14 @@ const json_flag &flag_id::obj() const
     return json_flags_all.obj( *this );
 }
 
+/** @relates int_id */
+template<>
+int_id<json_flag> flag_id::id() const
+{
+    // Undefined flags are reported by flag_id::is_valid, so don't warn about them here.
+    return json_flags_all.convert( *this, int_id<json_flag>( 0 ), false );
+}
+
 json_flag::operator bool() const
 {
     return id.is_valid();
@@ -121,6 +121,7 @@
 #include "item_pocket.h"
 #include "item_search.h"
 #include "item_stack.h"
+#include "item_tname.h"
 #include "iteminfo_query.h"
 #include "itype.h"
 #include "iuse.h"
@@ -7846,11 +7847,12 @@ static void add_item_recursive( std::vector<std::string> &item_order,
 {
     const std::string name = it->tname();
 
-    if( std::find( item_order.begin(), item_order.end(), name ) == item_order.end() ) {
+    const auto existing = temp_items.find( name );
+    if( existing == temp_items.end() ) {
         item_order.push_back( name );
-        temp_items[name] = map_item_stack( it, relative_pos );
+        temp_items.emplace( name, map_item_stack( it, relative_pos ) );
     } else {
-        temp_items[name].add_at_pos( it, relative_pos );
+        existing->second.add_at_pos( it, relative_pos );
     }
 
     for( const item *content : it->all_known_contents() ) {
@@ -8172,6 +8174,8 @@ void game::reset_item_list_state( const catacurses::window &window, int height,
 
 void game::list_items_monsters()
 {
+    // Items are grouped, filtered and redrawn by name many times while the list is open
+    tname::name_cache_scope name_cache;
     // Search whole reality bubble because each function internally verifies
     // the visibility of the items / monsters in question.
     std::vector<Creature *> mons = u.get_visible_creatures( 60 );
@@ -7,6 +7,8 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "avatar.h"
 #include "calendar.h"
@@ -130,6 +132,30 @@ invlet_favorites::get_invlets_by_id() const
 
 inventory::inventory() = default;
 
+// binned_items points into the stacks of the inventory it was built for, so copies rebuild it.
+inventory::inventory( const inventory &rhs ) : visitable( rhs ),
+    assigned_invlet( rhs.assigned_invlet ), invlet_cache( rhs.invlet_cache ), items( rhs.items ),
+    max_empty_liq_cont( rhs.max_empty_liq_cont ),
+    provisioned_pseudo_tools( rhs.provisioned_pseudo_tools )
+{
+}
+
+inventory &inventory::operator=( const inventory &rhs )
+{
+    if( this == &rhs ) {
+        return *this;
+    }
+    assigned_invlet = rhs.assigned_invlet;
+    invlet_cache = rhs.invlet_cache;
+    items = rhs.items;
+    max_empty_liq_cont = rhs.max_empty_liq_cont;
+    provisioned_pseudo_tools = rhs.provisioned_pseudo_tools;
+    binned = false;
+    binned_items.clear();
+    quality_levels.clear();
+    return *this;
+}
+
 invslice inventory::slice()
 {
     invslice stacks;
@@ -253,7 +279,7 @@ void inventory::clear()
     items.clear();
     max_empty_liq_cont.clear();
     binned = false;
-    qualities_cache.clear();
+    quality_levels.clear();
 }
 
 void inventory::push_back( const std::list<item> &newits )
@@ -417,18 +443,26 @@ void inventory::restack( Character &p )
 
     // combine matching stacks
     // separate loop to ensure that ALL stacks are homogeneous
-    for( invstack::iterator iter = items.begin(); iter != items.end(); ++iter ) {
-        for( invstack::iterator other = iter; other != items.end(); ++other ) {
-            if( iter != other && iter->front().stacks_with( other->front() ) ) {
-                if( other->front().count_by_charges() ) {
-                    iter->front().charges += other->front().charges;
-                } else {
-                    iter->splice( iter->begin(), *other );
-                }
-                other = items.erase( other );
-                --other;
-            }
+    // Stacks are bucketed by item::stacking_hash so each one is only compared with the
+    // earlier stacks it could possibly merge into.
+    std::unordered_map<std::size_t, std::vector<invstack::iterator>> stacks_by_hash;
+    for( invstack::iterator other = items.begin(); other != items.end(); ) {
+        std::vector<invstack::iterator> &candidates = stacks_by_hash[other->front().stacking_hash()];
+        const auto iter = std::find_if( candidates.begin(), candidates.end(),
+        [&other]( const invstack::iterator & candidate ) {
+            return candidate->front().stacks_with( other->front() );
+        } );
+        if( iter == candidates.end() ) {
+            candidates.push_back( other );
+            ++other;
+            continue;
+        }
+        if( other->front().count_by_charges() ) {
+            ( *iter )->front().charges += other->front().charges;
+        } else {
+            ( *iter )->splice( ( *iter )->begin(), *other );
         }
+        other = items.erase( other );
     }
 
     //re-add non-matching items
@@ -1124,6 +1158,7 @@ const itype_bin &inventory::get_binned_items() const
     }
 
     binned_items.clear();
+    quality_levels.clear();
 
     // HACK: Hack warning
     inventory *this_nonconst = const_cast<inventory *>( this );
@@ -97,20 +97,6 @@ class invlet_favorites
         std::array<itype_id, 256> ids_by_invlet;
 };
 
-struct quality_query {
-    quality_id qual;
-    int level;
-    int count;
-
-    bool operator==( const quality_query &other ) const {
-        return qual == other.qual && level == other.level && count == other.count;
-    }
-
-    bool operator<( const quality_query &other ) const {
-        return std::tie( qual, level, count ) < std::tie( other.qual, other.level, other.count );
-    }
-};
-
 class inventory : public visitable
 {
     public:
@@ -124,9 +110,9 @@ class inventory : public visitable
 
         inventory();
         inventory( inventory && ) noexcept = default;
-        inventory( const inventory & ) = default;
+        inventory( const inventory &rhs );
         inventory &operator=( inventory && ) = default;
-        inventory &operator=( const inventory & ) = default;
+        inventory &operator=( const inventory &rhs );
 
         inventory &operator+= ( const inventory &rhs );
         inventory &operator+= ( const item &rhs );
@@ -299,7 +285,12 @@ class inventory : public visitable
          */
         mutable itype_bin binned_items;
 
-        mutable std::map<quality_query, bool> qualities_cache;
+        /**
+         * For each quality asked about, how many items there are at each level of it.
+         * Filled one quality at a time with a single pass over the items, and dropped
+         * together with the item bins whenever the contents change.
+         */
+        mutable std::map<quality_id, std::map<int, int>> quality_levels;
 };
 
 #endif // CATA_SRC_INVENTORY_H
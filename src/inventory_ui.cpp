@@ -131,16 +131,21 @@ using pred_t = std::function<bool( inventory_entry const & )>;
 void move_if( std::vector<inventory_entry> &src, std::vector<inventory_entry> &dst,
               pred_t const &pred )
 {
-    for( auto it = src.begin(); it != src.end(); ) {
+    // Compact the kept entries in one pass; erasing them one at a time is quadratic
+    auto kept = src.begin();
+    for( auto it = src.begin(); it != src.end(); ++it ) {
         if( pred( *it ) ) {
             if( it->is_item() ) {
                 dst.emplace_back( std::move( *it ) );
             }
-            it = src.erase( it );
         } else {
-            ++it;
+            if( kept != it ) {
+                *kept = std::move( *it );
+            }
+            ++kept;
         }
     }
+    src.erase( kept, src.end() );
 }
 
 bool always_yes( const inventory_entry & )
@@ -1364,10 +1369,14 @@ bool inventory_column::sort_compare( inventory_entry const &lhs, inventory_entry
 
 bool inventory_column::indented_sort_compare( inventory_entry const &lhs,
         inventory_entry const &rhs )
+{
+    return indented_sort_compare( lhs, rhs, path_to_top( lhs, preset ), path_to_top( rhs, preset ) );
+}
+
+bool inventory_column::indented_sort_compare( inventory_entry const &lhs,
+        inventory_entry const &rhs, parent_path_t const &path_lhs, parent_path_t const &path_rhs )
 {
     // place children below all parents
-    parent_path_t const path_lhs = path_to_top( lhs, preset );
-    parent_path_t const path_rhs = path_to_top( rhs, preset );
     parent_path_t::size_type const common_depth = std::min( path_lhs.size(), path_rhs.size() );
     parent_path_t::size_type li = path_lhs.size() - common_depth;
     parent_path_t::size_type ri = path_rhs.size() - common_depth;
@@ -1506,52 +1515,76 @@ void inventory_column::prepare_paging( const std::string &filter )
     // remove entries hidden by SHOW_HIDE_CONTENTS
     move_if( entries, entries_hidden, is_not_visible );
 
-    // Then sort them with respect to categories
-    std::stable_sort( entries.begin(), entries.end(),
-    [this]( const inventory_entry & lhs, const inventory_entry & rhs ) {
+    // Then sort them with respect to categories. The paths used to indent entries are
+    // built once per entry instead of once per comparison.
+    const bool indented = !_collated && indent_entries();
+    std::vector<parent_path_t> paths;
+    if( indented ) {
+        paths.reserve( entries.size() );
+        for( const inventory_entry &entry : entries ) {
+            paths.emplace_back( path_to_top( entry, preset ) );
+        }
+    }
+    std::vector<size_t> order( entries.size() );
+    std::iota( order.begin(), order.end(), 0 );
+    std::stable_sort( order.begin(), order.end(), [&]( const size_t l, const size_t r ) {
+        const inventory_entry &lhs = entries[l];
+        const inventory_entry &rhs = entries[r];
         if( *lhs.get_category_ptr() == *rhs.get_category_ptr() ) {
             if( _collated ) {
                 return collated_sort_compare( lhs, rhs );
             }
-            if( indent_entries() ) {
-                return indented_sort_compare( lhs, rhs );
+            if( indented ) {
+                return indented_sort_compare( lhs, rhs, paths[l], paths[r] );
             }
 
             return sort_compare( lhs, rhs );
         }
         return preset.cat_sort_compare( lhs, rhs );
     } );
+    entries_t sorted;
+    sorted.reserve( entries.size() );
+    for( const size_t i : order ) {
+        sorted.emplace_back( std::move( entries[i] ) );
+    }
+    entries = std::move( sorted );
 
     if( !_collated && collate_entries() ) {
         collate();
     }
 
     // Recover categories
+    entries_t categorized;
+    categorized.reserve( entries.size() );
     const item_category *current_category = nullptr;
-    for( auto iter = entries.begin(); iter != entries.end(); ++iter ) {
-        if( iter->get_category_ptr() == current_category ) {
-            continue;
+    for( inventory_entry &entry : entries ) {
+        if( entry.get_category_ptr() != current_category ) {
+            current_category = entry.get_category_ptr();
+            categorized.emplace_back( current_category );
         }
-        current_category = iter->get_category_ptr();
-        iter = entries.insert( iter, inventory_entry( current_category ) );
+        categorized.emplace_back( std::move( entry ) );
     }
+    entries = std::move( categorized );
     // Determine the new height.
     entries_per_page = height;
     if( entries.size() > entries_per_page ) {
         entries_per_page -= 1;  // Make room for the page number.
-        for( size_t i = entries_per_page - 1; i < entries.size(); i += entries_per_page ) {
-            auto iter = std::next( entries.begin(), i );
-            if( iter->is_category() ) {
+    }
+    if( entries.size() > entries_per_page && entries_per_page > 1 ) {
+        entries_t paged;
+        paged.reserve( entries.size() + entries.size() / entries_per_page + 1 );
+        for( inventory_entry &entry : entries ) {
+            const size_t slot = paged.size() % entries_per_page;
+            if( entry.is_category() && slot == entries_per_page - 1 ) {
                 // The last item on the page must not be a category.
-                entries.insert( iter, inventory_entry() );
-            } else {
+                paged.emplace_back();
+            } else if( entry.is_item() && slot == 0 && !paged.empty() ) {
                 // The first item on the next page must be a category.
-                iter = std::next( iter );
-                if( iter != entries.end() && iter->is_item() ) {
-                    entries.insert( iter, inventory_entry( iter->get_category_ptr() ) );
-                }
+                paged.emplace_back( entry.get_category_ptr() );
             }
+            paged.emplace_back( std::move( entry ) );
         }
+        entries = std::move( paged );
     }
     paging_is_valid = true;
     // Select the uppermost possible entry
@@ -507,6 +507,10 @@ class inventory_column
 
         bool sort_compare( inventory_entry const &lhs, inventory_entry const &rhs );
         bool indented_sort_compare( inventory_entry const &lhs, inventory_entry const &rhs );
+        /** Same as above with the entries' paths to their topmost shown parent already known. */
+        bool indented_sort_compare( inventory_entry const &lhs, inventory_entry const &rhs,
+                                    std::vector<item_location> const &path_lhs,
+                                    std::vector<item_location> const &path_rhs );
         bool collated_sort_compare( inventory_entry const &lhs, inventory_entry const &rhs );
 
         /**
@@ -16,6 +16,7 @@
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -56,6 +57,7 @@
 #include "game.h"
 #include "game_constants.h"
 #include "gun_mode.h"
+#include "hash_utils.h"
 #include "iexamine.h"
 #include "inventory.h"
 #include "item_category.h"
@@ -101,6 +103,7 @@
 #include "string_id.h"
 #include "string_id_utils.h"
 #include "text_snippets.h"
+#include "translation_cache.h"
 #include "translations.h"
 #include "trap.h"
 #include "try_parse_integer.h"
@@ -633,7 +636,9 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
 
     // This is unconditional because the const itemructor above sets result.name to
     // "human corpse".
-    result.corpse_name = name;
+    if( !name.empty() || result.cold_ ) {
+        result.cold().corpse_name = name;
+    }
 
     return result;
 }
@@ -1643,7 +1648,8 @@ bool _stacks_components( item const &lhs, item const &rhs, bool check_components
 {
     return ( !check_components && !lhs.is_comestible() && !lhs.is_craft() ) ||
            // Only check if at least one item isn't using the default recipe or is comestible
-           ( lhs.components.empty() && rhs.components.empty() ) ||
+           // Copies of the same craft share their component list
+           lhs.components.shares_storage_with( rhs.components ) ||
            ( lhs.get_uncraft_components() == rhs.get_uncraft_components() );
 }
 
@@ -1739,7 +1745,7 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::CORPSE,
               ( corpse == nullptr && rhs.corpse == nullptr ) ||
               ( corpse != nullptr && rhs.corpse != nullptr && corpse->id == rhs.corpse->id &&
-                corpse_name == rhs.corpse_name ) );
+                get_corpse_name() == rhs.get_corpse_name() ) );
     bits.set( tname::segments::FOOD_PERISHABLE, _stacks_food_perishable( *this, rhs, check_cat ) );
     bits.set( tname::segments::CLOTHING_SIZE, _stacks_clothing_size( *this, rhs ) );
     bits.set( tname::segments::BROKEN, is_broken() == rhs.is_broken() );
@@ -1763,6 +1769,22 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     return { bits };
 }
 
+std::size_t item::stacking_hash() const
+{
+    std::size_t seed = 0;
+    cata::hash_combine( seed, type );
+    cata::hash_combine( seed, count_by_charges() ? 0 : charges );
+    cata::hash_combine( seed, is_favorite );
+    cata::hash_combine( seed, burnt );
+    cata::hash_combine( seed, active );
+    cata::hash_combine( seed, degradation_ );
+    cata::hash_combine( seed, corpse == nullptr ? mtype_id::NULL_ID() : corpse->id );
+    for( const fault_id &f : faults ) {
+        cata::hash_combine( seed, f );
+    }
+    return seed;
+}
+
 bool item::same_contents( const item &rhs ) const
 {
     return get_contents().same_contents( rhs.get_contents() );
@@ -1822,29 +1844,22 @@ void item::force_insert_item( const item &it, pocket_type pk_type )
     on_contents_changed();
 }
 
+// std::to_string is locale independent for integers, so no stream with the classic locale
+// imbued has to be built for every call.
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 void item::set_var( const std::string &name, const double value )
@@ -2211,12 +2226,40 @@ faction_id item::get_owner() const
 faction_id item::get_old_owner() const
 {
     validate_ownership();
-    return old_owner;
+    return cold_ ? cold_->old_owner : faction_id::NULL_ID();
+}
+
+void item::set_old_owner( const faction_id &temp_owner )
+{
+    if( !temp_owner.is_null() || cold_ ) {
+        cold().old_owner = temp_owner;
+    }
+}
+
+item::cold_data &item::cold()
+{
+    if( !cold_ ) {
+        cold_ = cata::make_value<cold_data>();
+    }
+    return *cold_;
+}
+
+harvest_drop_type_id item::get_dropped_from() const
+{
+    return cold_ ? cold_->dropped_from : harvest_drop_type_id::NULL_ID();
+}
+
+void item::set_dropped_from( const harvest_drop_type_id &drop_type )
+{
+    if( !drop_type.is_null() || cold_ ) {
+        cold().dropped_from = drop_type;
+    }
 }
 
 void item::validate_ownership() const
 {
-    if( !old_owner.is_null() && !g->faction_manager_ptr->get( old_owner, false ) ) {
+    if( cold_ && !cold_->old_owner.is_null() &&
+        !g->faction_manager_ptr->get( cold_->old_owner, false ) ) {
         remove_old_owner();
     }
     if( !owner.is_null() && !g->faction_manager_ptr->get( owner, false ) ) {
@@ -2533,7 +2576,7 @@ void item::debug_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         if( g != nullptr ) {
             info.emplace_back( "BASE", string_format( "itype_id: %s",
                                typeId().str() ) );
-            if( !old_owner.is_null() ) {
+            if( cold_ && !cold_->old_owner.is_null() ) {
                 info.emplace_back( "BASE", string_format( _( "Old owner: %s" ),
                                    _( get_old_owner_name() ) ) );
             }
@@ -6855,7 +6898,71 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
     return tname( quantity, with_prefix ? tname::default_tname : tname::unprefixed_tname );
 }
 
+namespace
+{
+struct tname_cache_entry {
+    std::size_t fingerprint;
+    std::string name;
+};
+using tname_cache_key = std::tuple<const item *, unsigned int, unsigned long long>;
+std::unordered_map<tname_cache_key, tname_cache_entry, cata::tuple_hash> tname_cache;
+int tname_cache_users = 0;
+} // namespace
+
+tname::name_cache_scope::name_cache_scope()
+{
+    tname_cache_users++;
+}
+
+tname::name_cache_scope::~name_cache_scope()
+{
+    tname_cache_users--;
+    if( tname_cache_users <= 0 ) {
+        tname_cache.clear();
+    }
+}
+
+std::size_t item::tname_fingerprint() const
+{
+    std::size_t seed = 0;
+    cata::hash_combine( seed, type );
+    cata::hash_combine( seed, charges );
+    cata::hash_combine( seed, damage_ );
+    cata::hash_combine( seed, degradation_ );
+    cata::hash_combine( seed, burnt );
+    cata::hash_combine( seed, active );
+    cata::hash_combine( seed, is_favorite );
+    cata::hash_combine( seed, corpse );
+    cata::hash_combine( seed, _itype_variant );
+    cata::hash_combine( seed, contents.num_item_stacks() );
+    cata::hash_combine( seed, to_turn<int>( calendar::turn ) );
+    cata::hash_combine( seed, detail::get_current_language_version() );
+    for( const flag_id &f : item_tags ) {
+        cata::hash_combine( seed, f );
+    }
+    for( const std::pair<const std::string, std::string> &var : item_vars ) {
+        cata::hash_combine( seed, var.first );
+        cata::hash_combine( seed, var.second );
+    }
+    return seed;
+}
+
 std::string item::tname( unsigned int quantity, tname::segment_bitset const &segments ) const
+{
+    if( tname_cache_users <= 0 ) {
+        return tname_uncached( quantity, segments );
+    }
+    const std::size_t fingerprint = tname_fingerprint();
+    tname_cache_entry &entry = tname_cache[tname_cache_key( this, quantity, segments.to_ullong() )];
+    if( entry.name.empty() || entry.fingerprint != fingerprint ) {
+        entry.fingerprint = fingerprint;
+        entry.name = tname_uncached( quantity, segments );
+    }
+    return entry.name;
+}
+
+std::string item::tname_uncached( unsigned int quantity,
+                                  tname::segment_bitset const &segments ) const
 {
     std::string ret;
 
@@ -12862,8 +12969,7 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
     if( now - time > 1_hours ) {
         // This code is for items that were left out of reality bubble for long time
 
-        const weather_generator &wgen = get_weather().get_cur_weather_gen();
-        const unsigned int seed = g->get_seed();
+        weather_manager &weather = get_weather();
 
         units::temperature_delta temp_mod;
         // Toilets and vending machines will try to get the heat radiation and convection during mapgen and segfault.
@@ -12882,6 +12988,12 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
         // Process the past of this item in 1h chunks until there is less than 1h left.
         time_duration time_delta = 1_hours;
 
+        // Temperature older than 2 days is not tracked, so without rot or air decay
+        // those hours would be no-ops. Skip straight to the first one that matters.
+        if( !process_rot && !decays_in_air && now - time > 2_days + time_delta ) {
+            time += to_hours<int>( now - time - 2_days ) * time_delta;
+        }
+
         while( now - time > 1_hours ) {
             time += time_delta;
 
@@ -12889,7 +13001,7 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
             // Use weather if above ground, use map temp if below
             units::temperature env_temperature;
             if( pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR ) {
-                env_temperature = wgen.get_weather_temperature( pos, time, seed );
+                env_temperature = weather.get_weather_temperature( pos, time );
             } else {
                 env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
             }
@@ -14758,14 +14870,14 @@ std::string item::type_name( unsigned int quantity, bool use_variant, bool use_c
 
     // Identify who this corpse belonged to, if applicable.
     if( corpse != nullptr && use_corpse && has_flag( flag_CORPSE ) ) {
-        if( corpse_name.empty() ) {
+        if( !cold_ || cold_->corpse_name.empty() ) {
             //~ %1$s: name of corpse with modifiers;  %2$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of a %2$s" ),
                                       ret_name, corpse->nname() );
         } else {
             //~ %1$s: name of corpse with modifiers;  %2$s: proper name;  %3$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of %2$s, %3$s" ),
-                                      ret_name, corpse_name, corpse->nname() );
+                                      ret_name, cold_->corpse_name, corpse->nname() );
         }
     }
 
@@ -14779,7 +14891,7 @@ const mtype *item::get_corpse_mon() const
 
 std::string item::get_corpse_name() const
 {
-    return corpse_name;
+    return cold_ ? cold_->corpse_name : std::string();
 }
 
 std::string item::nname( const itype_id &id, unsigned int quantity )
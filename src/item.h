@@ -630,6 +630,12 @@ class item : public visitable
         stacking_info stacks_with( const item &rhs, bool check_components = false,
                                    bool combine_liquid = false, bool check_cat = false,
                                    int depth = 0, int maxdepth = 2, bool precise = false ) const;
+        /**
+         * Hash of some of the fields stacks_with() requires to be exactly equal (with check_cat
+         * unset), so that items which stack always have the same hash.  Lets callers grouping
+         * many items bucket them first and only call stacks_with() within a bucket.
+         */
+        std::size_t stacking_hash() const;
 
         /**
          * Whether the two items have same contents.
@@ -2837,11 +2843,11 @@ class item : public visitable
         units::energy get_gun_bionic_drain() const;
 
         void validate_ownership() const;
-        inline void set_old_owner( const faction_id &temp_owner ) {
-            old_owner = temp_owner;
-        }
+        void set_old_owner( const faction_id &temp_owner );
         inline void remove_old_owner() const {
-            old_owner = faction_id::NULL_ID();
+            if( cold_ ) {
+                cold_->old_owner = faction_id::NULL_ID();
+            }
         }
         void set_owner( const faction_id &new_owner );
         void set_owner( const Character &c );
@@ -3120,10 +3126,6 @@ class item : public visitable
 
     private:
         item_contents contents;
-        /** `true` if item has any of the flags that require processing in item::process_internal.
-         * This flag is reset to `true` if item tags are changed.
-         */
-        bool requires_tags_processing = true;
         cata::heap<FlagsSetType> item_tags; // generic item specific flags
         cata::heap<FlagsSetType> inherited_tags_cache;
         cata::heap<FlagsSetType> prefix_tags_cache; // flags that will add prefixes to this item
@@ -3131,7 +3133,6 @@ class item : public visitable
         lazy<safe_reference_anchor> anchor;
         cata::heap<std::map<std::string, std::string>> item_vars;
         const mtype *corpse = nullptr;
-        std::string corpse_name;       // Name of the late lamented
         cata::heap<std::set<matec_id>> techniques; // item specific techniques
 
         // Select a random variant from the possibilities
@@ -3146,6 +3147,10 @@ class item : public visitable
         // If the item has a gun variant, this points to it
         const itype_variant_data *_itype_variant = nullptr;
 
+        std::string tname_uncached( unsigned int quantity, tname::segment_bitset const &segments ) const;
+        // Hash of the state tname() depends on, checked by tname::name_cache_scope
+        std::size_t tname_fingerprint() const;
+
         /**
          * Data for items that represent in-progress crafts.
          */
@@ -3169,6 +3174,21 @@ class item : public visitable
         };
 
         cata::value_ptr<craft_data> craft_data_;
+
+        /**
+         * State that only a handful of items ever carry. Kept out of line so
+         * that the common item stays small; allocated on the first non-default write.
+         */
+        struct cold_data {
+            std::string corpse_name;       // Name of the late lamented
+            // The faction that previously owned this item
+            faction_id old_owner = faction_id::NULL_ID();
+            // The drop type this item spawned from
+            harvest_drop_type_id dropped_from = harvest_drop_type_id::NULL_ID();
+        };
+
+        mutable cata::value_ptr<cold_data> cold_;
+        cold_data &cold();
     public:
         // any relic data specific to this item
         cata::value_ptr<relic> relic_data;
@@ -3191,18 +3211,13 @@ class item : public visitable
         units::temperature temperature = units::from_kelvin( 0 );       // Temperature of the item .
         int mission_id = -1;       // Refers to a mission in game's master list
         int player_id = -1;        // Only give a mission to the right player!
-        bool ethereal = false;
         int wetness = 0;           // Turns until this item is completely dry.
 
         int seed = rng( 0, INT_MAX );  // A random seed for layering and other options
 
-        harvest_drop_type_id dropped_from =
-            harvest_drop_type_id::NULL_ID(); // The drop type this item spawned from
-
-        // Set when the item / its content changes. Used for worn item with
-        // encumbrance depending on their content.
-        // This not part serialized or compared on purpose!
-        bool encumbrance_update_ = false;
+        // The drop type this item spawned from
+        harvest_drop_type_id get_dropped_from() const;
+        void set_dropped_from( const harvest_drop_type_id &drop_type );
 
         item_contents &get_contents() {
             return contents;
@@ -3230,10 +3245,12 @@ class item : public visitable
          * PNULL.
          */
         phase_id current_phase = static_cast<phase_id>( 0 );
+        /** `true` if item has any of the flags that require processing in item::process_internal.
+         * This flag is reset to `true` if item tags are changed.
+         */
+        bool requires_tags_processing = true;
         // The faction that owns this item.
         mutable faction_id owner = faction_id::NULL_ID();
-        // The faction that previously owned this item
-        mutable faction_id old_owner = faction_id::NULL_ID();
         int damage_ = 0;
         int degradation_ = 0;
         light_emission light = nolight;
@@ -3253,6 +3270,12 @@ class item : public visitable
         char invlet = 0;      // Inventory letter
         bool active = false; // If true, it has active effects to be processed
         bool is_favorite = false;
+        bool ethereal = false;
+
+        // Set when the item / its content changes. Used for worn item with
+        // encumbrance depending on their content.
+        // This not part serialized or compared on purpose!
+        bool encumbrance_update_ = false;
 
         void set_favorite( bool favorite );
         bool has_clothing_mod() const;
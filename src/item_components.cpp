@@ -1,69 +1,102 @@
 #include "item_components.h"
 
+#include <utility>
+
 #include "flag.h"
 #include "item.h"
 #include "itype.h"
 #include "type_id.h"
 
+// Handed out for lists that were never allocated. Nothing can be inserted through
+// map iterators, so this stays empty.
+static std::map<itype_id, std::vector<item>> &no_comps()
+{
+    static std::map<itype_id, std::vector<item>> empty;
+    return empty;
+}
+
+item_components::comp_map &item_components::mutable_comps()
+{
+    if( !comps ) {
+        comps = std::make_shared<comp_map>();
+    } else if( comps.use_count() > 1 ) {
+        comps = std::make_shared<comp_map>( *comps );
+    }
+    return *comps;
+}
+
+const item_components::comp_map &item_components::get_comps() const
+{
+    return comps ? *comps : no_comps();
+}
+
 std::vector<item> item_components::operator[]( const itype_id it_id )
 {
-    return comps[it_id];
+    return mutable_comps()[it_id];
 }
 
 item_components::comp_iterator item_components::begin()
 {
-    return comps.begin();
+    if( !comps ) {
+        return no_comps().begin();
+    }
+    return mutable_comps().begin();
 }
 item_components::comp_iterator item_components::end()
 {
-    return comps.end();
+    if( !comps ) {
+        return no_comps().end();
+    }
+    return mutable_comps().end();
 }
 item_components::const_comp_iterator item_components::begin() const
 {
-    return comps.begin();
+    return get_comps().begin();
 }
 item_components::const_comp_iterator item_components::end() const
 {
-    return comps.end();
+    return get_comps().end();
 }
 
 bool item_components::empty()
 {
-    return comps.empty();
+    return get_comps().empty();
 }
 
 bool item_components::empty() const
 {
-    return comps.empty();
+    return get_comps().empty();
 }
 
 void item_components::clear()
 {
-    comps.clear();
+    comps.reset();
+}
+
+bool item_components::shares_storage_with( const item_components &rhs ) const
+{
+    return comps == rhs.comps || ( empty() && rhs.empty() );
 }
 
 item item_components::only_item()
 {
-    if( comps.size() != 1 || comps.begin()->second.size() != 1 ) {
-        debugmsg( "item_components::only_item called but components don't contain exactly one item" );
-        return item();
-    }
-    return *comps.begin()->second.begin();
+    return std::as_const( *this ).only_item();
 }
 
 item item_components::only_item() const
 {
-    if( comps.size() != 1 || comps.begin()->second.size() != 1 ) {
+    const comp_map &c = get_comps();
+    if( c.size() != 1 || c.begin()->second.size() != 1 ) {
         debugmsg( "item_components::only_item called but components don't contain exactly one item" );
         return item();
     }
-    return *comps.begin()->second.begin();
+    return *c.begin()->second.begin();
 }
 
 size_t item_components::size() const
 {
     size_t ret = 0;
-    for( const type_vector_pair &tvp : comps ) {
+    for( const type_vector_pair &tvp : get_comps() ) {
         ret += tvp.second.size();
     }
     return ret;
@@ -71,39 +104,42 @@ size_t item_components::size() const
 
 void item_components::add( item &new_it )
 {
-    comp_iterator it = comps.find( new_it.typeId() );
-    if( it != comps.end() ) {
+    comp_map &target = mutable_comps();
+    comp_iterator it = target.find( new_it.typeId() );
+    if( it != target.end() ) {
         if( it->first->count_by_charges() ) {
             it->second.front().charges += new_it.charges;
         } else {
             it->second.push_back( new_it );
         }
     } else {
-        comps[new_it.typeId()] = { new_it };
+        target[new_it.typeId()] = { new_it };
     }
 }
 
 ret_val<item> item_components::remove( itype_id it_id )
 {
-    comp_iterator it = comps.find( it_id );
-    if( it == comps.end() ) {
+    if( get_comps().count( it_id ) == 0 ) {
         return ret_val<item>::make_failure( item() );
     }
+    comp_map &target = mutable_comps();
+    comp_iterator it = target.find( it_id );
     item itm = *it->second.begin();
     it->second.erase( it->second.begin() );
     if( it->second.empty() ) {
-        comps.erase( it );
+        target.erase( it );
     }
     return ret_val<item>::make_success( itm );
 }
 
 item item_components::get_and_remove_random_entry()
 {
-    comp_iterator iter = comps.begin();
-    std::advance( iter, rng( 0, comps.size() - 1 ) );
+    comp_map &target = mutable_comps();
+    comp_iterator iter = target.begin();
+    std::advance( iter, rng( 0, target.size() - 1 ) );
     item ret = random_entry_removed( iter->second );
     if( iter->second.empty() ) {
-        comps.erase( iter );
+        target.erase( iter );
     }
     return ret;
 }
@@ -122,11 +158,11 @@ static void adjust_new_comp( item &new_comp, bool is_cooked )
 }
 
 item_components item_components::split( const int batch_size, const size_t offset,
-                                        const bool is_cooked )
+                                        const bool is_cooked ) const
 {
     item_components ret;
 
-    for( item_components::type_vector_pair &tvp : comps ) {
+    for( const item_components::type_vector_pair &tvp : get_comps() ) {
         if( tvp.first->count_by_charges() ) {
             if( tvp.second.size() != 1 ) {
                 debugmsg( "count by charges component %s wasn't merged properly, can't distribute components to resulting items",
@@ -164,12 +200,12 @@ item_components item_components::split( const int batch_size, const size_t offse
 
 void item_components::serialize( JsonOut &jsout ) const
 {
-    jsout.write( comps );
+    jsout.write( get_comps() );
 }
 
 void item_components::deserialize( const JsonValue &jv )
 {
-    comps.clear();
+    comps.reset();
     // read legacy arrays
     if( jv.test_array() ) {
         std::list<item> temp;
@@ -178,6 +214,10 @@ void item_components::deserialize( const JsonValue &jv )
             add( it );
         }
     } else {
-        jv.read( comps );
+        comp_map loaded;
+        jv.read( loaded );
+        if( !loaded.empty() ) {
+            comps = std::make_shared<comp_map>( std::move( loaded ) );
+        }
     }
 }
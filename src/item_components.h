@@ -4,11 +4,11 @@
 
 #include <iterator>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
 #include "type_id.h"
-#include "value_ptr.h"
 
 class item;
 class JsonOut;
@@ -16,16 +16,31 @@ class JsonValue;
 template<typename T>
 class ret_val;
 
+/**
+ * The items consumed to make a crafted item, grouped by type.
+ *
+ * Copies share one immutable list (empty lists don't allocate at all) and the
+ * list is only cloned when a copy that shares it is about to be modified, so
+ * stacks of identical crafts don't each carry a deep copy of their component tree.
+ * The non-const accessors are the modifying ones: don't hold on to references
+ * obtained through them across a copy of this object.
+ */
 class item_components
 {
     private:
-        cata::heap<std::map<itype_id, std::vector<item>>> comps;
-        using comp_iterator = std::map<itype_id, std::vector<item>>::iterator;
-        using const_comp_iterator = std::map<itype_id, std::vector<item>>::const_iterator;
+        using comp_map = std::map<itype_id, std::vector<item>>;
+        std::shared_ptr<comp_map> comps;
+        using comp_iterator = comp_map::iterator;
+        using const_comp_iterator = comp_map::const_iterator;
+
+        // Makes sure this object is the only owner of its list, allocating it if needed
+        comp_map &mutable_comps();
+        const comp_map &get_comps() const;
 
     public:
         using type_vector_pair = std::pair<const itype_id, std::vector<item>>;
 
+        // These detach from any copy sharing the same list
         comp_iterator begin();
         comp_iterator end();
         const_comp_iterator begin() const;
@@ -49,7 +64,10 @@ class item_components
         item get_and_remove_random_entry();
 
         // used to distribute the components of a finished craft to the resulting items
-        item_components split( int batch_size, size_t offset, bool is_cooked = false );
+        item_components split( int batch_size, size_t offset, bool is_cooked = false ) const;
+
+        // True if both are empty or are copies still sharing the same list
+        bool shares_storage_with( const item_components &rhs ) const;
 
         void serialize( JsonOut &jsout ) const;
         void deserialize( const JsonValue &jv );
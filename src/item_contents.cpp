@@ -903,6 +903,8 @@ std::pair<item_location, item_pocket *> item_contents::best_pocket( const item &
 {
     // @TODO: this could be made better by doing a plain preliminary volume check.
     // if the total volume of the parent is not sufficient, a child won't have enough either.
+    // Every candidate is compared by remaining volume and weight, don't re-sum them each time.
+    item_pocket::totals_cache_scope totals_cache;
     std::pair<item_location, item_pocket *> ret = { this_loc, nullptr };
     std::vector<item_pocket *> valid_pockets;
     for( item_pocket &pocket : contents ) {
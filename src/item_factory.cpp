@@ -752,6 +752,15 @@ void Item_factory::finalize_post( itype &obj )
         return false;
     } );
 
+    obj.item_tags_mask.clear();
+    for( const flag_id &f : obj.item_tags ) {
+        const std::size_t i = f.id().to_i();
+        if( i >= obj.item_tags_mask.size() ) {
+            obj.item_tags_mask.resize( i + 1 );
+        }
+        obj.item_tags_mask[i] = true;
+    }
+
     if( obj.gun && !obj.gunmod && !obj.has_flag( flag_PRIMITIVE_RANGED_WEAPON ) ) {
         const quality_id qual_gun_skill( to_upper_case( obj.gun->skill_used.str() ) );
 
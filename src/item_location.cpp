@@ -280,6 +280,7 @@ class item_location::impl::item_on_map : public item_location::impl
 
         void on_contents_changed() override {
             target()->on_contents_changed();
+            map::bump_items_revision();
         }
 
         units::volume volume_capacity() const override {
@@ -555,6 +556,7 @@ class item_location::impl::item_on_vehicle : public item_location::impl
         void on_contents_changed() override {
             target()->on_contents_changed();
             cur.veh.invalidate_mass();
+            map::bump_items_revision();
         }
 
         void make_active( item_location &head ) {
@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <cstdlib>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "ammo.h"
@@ -604,31 +606,74 @@ int item_pocket::remaining_capacity_for_item( const item &it ) const
     }
 }
 
+namespace
+{
+struct pocket_totals {
+    std::optional<units::volume> contains_volume;
+    std::optional<units::mass> contains_weight;
+    std::optional<units::volume> size_modifier;
+    std::optional<units::mass> weight_modifier;
+};
+std::unordered_map<const item_pocket *, pocket_totals> pocket_totals_cache;
+int pocket_totals_cache_users = 0;
+
+template<typename T, typename F>
+T cached_pocket_total( const item_pocket *pocket, std::optional<T> pocket_totals::*member,
+                       F compute )
+{
+    if( pocket_totals_cache_users <= 0 ) {
+        return compute();
+    }
+    std::optional<T> &cached = pocket_totals_cache[pocket].*member;
+    if( !cached ) {
+        cached = compute();
+    }
+    return *cached;
+}
+} // namespace
+
+item_pocket::totals_cache_scope::totals_cache_scope()
+{
+    pocket_totals_cache_users++;
+}
+
+item_pocket::totals_cache_scope::~totals_cache_scope()
+{
+    pocket_totals_cache_users--;
+    if( pocket_totals_cache_users <= 0 ) {
+        pocket_totals_cache.clear();
+    }
+}
+
 units::volume item_pocket::item_size_modifier() const
 {
     if( data->rigid ) {
         return 0_ml;
     }
-    units::volume total_vol = 0_ml;
-    for( const item &it : contents ) {
-        total_vol += it.volume( is_type( pocket_type::MOD ) );
-    }
-    total_vol -= data->magazine_well;
-    total_vol *= data->volume_multiplier;
-    return std::max( 0_ml, total_vol );
+    return cached_pocket_total( this, &pocket_totals::size_modifier, [this]() {
+        units::volume total_vol = 0_ml;
+        for( const item &it : contents ) {
+            total_vol += it.volume( is_type( pocket_type::MOD ) );
+        }
+        total_vol -= data->magazine_well;
+        total_vol *= data->volume_multiplier;
+        return std::max( 0_ml, total_vol );
+    } );
 }
 
 units::mass item_pocket::item_weight_modifier() const
 {
-    units::mass total_mass = 0_gram;
-    for( const item &it : contents ) {
-        if( is_type( pocket_type::MOD ) ) {
-            total_mass += it.weight( true, true ) * data->weight_multiplier;
-        } else {
-            total_mass += it.weight() * data->weight_multiplier;
+    return cached_pocket_total( this, &pocket_totals::weight_modifier, [this]() {
+        units::mass total_mass = 0_gram;
+        for( const item &it : contents ) {
+            if( is_type( pocket_type::MOD ) ) {
+                total_mass += it.weight( true, true ) * data->weight_multiplier;
+            } else {
+                total_mass += it.weight() * data->weight_multiplier;
+            }
         }
-    }
-    return total_mass;
+        return total_mass;
+    } );
 }
 
 units::length item_pocket::item_length_modifier() const
@@ -2310,20 +2355,24 @@ units::length item_pocket::min_containable_length() const
 
 units::volume item_pocket::contains_volume() const
 {
-    units::volume vol = 0_ml;
-    for( const item &it : contents ) {
-        vol += it.volume();
-    }
-    return vol;
+    return cached_pocket_total( this, &pocket_totals::contains_volume, [this]() {
+        units::volume vol = 0_ml;
+        for( const item &it : contents ) {
+            vol += it.volume();
+        }
+        return vol;
+    } );
 }
 
 units::mass item_pocket::contains_weight() const
 {
-    units::mass weight = 0_gram;
-    for( const item &it : contents ) {
-        weight += it.weight();
-    }
-    return weight;
+    return cached_pocket_total( this, &pocket_totals::contains_weight, [this]() {
+        units::mass weight = 0_gram;
+        for( const item &it : contents ) {
+            weight += it.weight();
+        }
+        return weight;
+    } );
 }
 
 units::mass item_pocket::remaining_weight() const
@@ -230,6 +230,22 @@ class item_pocket
         units::mass item_weight_modifier() const;
         units::length item_length_modifier() const;
 
+        /**
+         * While at least one of these is alive, contains_volume(), contains_weight(),
+         * item_size_modifier() and item_weight_modifier() are memoized per pocket, so the
+         * totals of nested containers are summed once instead of once per query.
+         * Contents must not change meanwhile; meant for read-only searches such as picking
+         * the best pocket for an item.
+         */
+        class totals_cache_scope
+        {
+            public:
+                totals_cache_scope();
+                ~totals_cache_scope();
+                totals_cache_scope( const totals_cache_scope & ) = delete;
+                totals_cache_scope &operator=( const totals_cache_scope & ) = delete;
+        };
+
         /** gets the spoilage multiplier depending on sealed data */
         float spoil_multiplier() const;
 
@@ -1,6 +1,8 @@
 #include "item_search.h"
 
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include "avatar.h"
@@ -26,36 +28,51 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
     }
     switch( flag ) {
         // category
-        case 'c':
-            return [filter]( const item & i ) {
-                return lcmatch( i.get_category_of_contents().name_header(), filter );
+        case 'c': {
+            // There are few categories, so each one's name is matched only once
+            auto matched = std::make_shared<std::unordered_map<item_category_id, bool>>();
+            return [qry = lcmatch_query( filter ), matched]( const item & i ) {
+                const item_category &cat = i.get_category_of_contents();
+                auto it = matched->find( cat.get_id() );
+                if( it == matched->end() ) {
+                    it = matched->emplace( cat.get_id(), lcmatch( cat.name_header(), qry ) ).first;
+                }
+                return it->second;
             };
+        }
         // material
-        case 'm':
-            return [filter]( const item & i ) {
+        case 'm': {
+            auto matched = std::make_shared<std::unordered_map<material_id, bool>>();
+            return [qry = lcmatch_query( filter ), matched]( const item & i ) {
                 return std::any_of( i.made_of().begin(), i.made_of().end(),
-                [&filter]( const std::pair<material_id, int> &mat ) {
-                    return lcmatch( mat.first->name(), filter );
+                [&]( const std::pair<material_id, int> &mat ) {
+                    auto it = matched->find( mat.first );
+                    if( it == matched->end() ) {
+                        it = matched->emplace( mat.first, lcmatch( mat.first->name(), qry ) ).first;
+                    }
+                    return it->second;
                 } );
             };
+        }
         // qualities
         case 'q':
             return [filter]( const item & i ) {
                 return i.type->has_any_quality( filter );
             };
         // both
-        case 'b':
-            return [filter]( const item & i ) {
-                auto pair = get_both( filter );
-                return item_filter_from_string( pair.first )( i )
-                       && item_filter_from_string( pair.second )( i );
+        case 'b': {
+            const std::pair<std::string, std::string> pair = get_both( filter );
+            return [first = item_filter_from_string( pair.first ),
+                           second = item_filter_from_string( pair.second )]( const item & i ) {
+                return first( i ) && second( i );
             };
+        }
         // disassembled components
         case 'd':
-            return [filter]( const item & i ) {
+            return [qry = lcmatch_query( filter )]( const item & i ) {
                 const auto &components = i.get_uncraft_components();
                 for( const item_comp &component : components ) {
-                    if( lcmatch( component.to_string(), filter ) ) {
+                    if( lcmatch( component.to_string(), qry ) ) {
                         return true;
                     }
                 }
@@ -63,27 +80,29 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
             };
         // item notes
         case 'n':
-            return [filter]( const item & i ) {
+            return [qry = lcmatch_query( filter )]( const item & i ) {
                 const std::string note = i.get_var( "item_note" );
-                return !note.empty() && lcmatch( note, filter );
+                return !note.empty() && lcmatch( note, qry );
             };
         // item flags, must type in whole flag string name(case insensitive) so as to avoid revealing hidden flags.
-        case 'f':
-            return [filter]( const item & i ) {
-                std::string flag_filter = filter;
-                transform( flag_filter.begin(), flag_filter.end(), flag_filter.begin(), ::toupper );
-                const flag_id fsearch( flag_filter );
-                if( fsearch.is_valid() ) {
-                    return i.has_flag( fsearch );
-                } else {
+        case 'f': {
+            std::string flag_filter = filter;
+            transform( flag_filter.begin(), flag_filter.end(), flag_filter.begin(), ::toupper );
+            const flag_id fsearch( flag_filter );
+            if( !fsearch.is_valid() ) {
+                return []( const item & ) {
                     return false;
-                }
+                };
+            }
+            return [fsearch]( const item & i ) {
+                return i.has_flag( fsearch );
             };
+        }
         // by book skill
         case 's':
-            return [filter]( const item & i ) {
+            return [qry = lcmatch_query( filter )]( const item & i ) {
                 if( get_avatar().has_identified( i.typeId() ) ) {
-                    return lcmatch( i.get_book_skill(), filter );
+                    return lcmatch( i.get_book_skill(), qry );
                 }
                 return false;
             };
@@ -104,7 +123,7 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
                     }
                 }
             }
-            return [filter, filtered_bodyparts, filtered_sub_bodyparts]( const item & i ) {
+            return [filtered_bodyparts, filtered_sub_bodyparts]( const item & i ) {
                 return std::any_of( filtered_bodyparts.begin(), filtered_bodyparts.end(),
                 [&i]( const bodypart_id & bp ) {
                     return i.covers( bp );
@@ -117,8 +136,8 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
         }
         // by name
         default:
-            return [filter]( const item & a ) {
-                return lcmatch( remove_color_tags( a.tname() ), filter );
+            return [qry = lcmatch_query( filter )]( const item & a ) {
+                return lcmatch( remove_color_tags( a.tname() ), qry );
             };
     }
 }
@@ -76,8 +76,8 @@ std::function<bool( const T & )> filter_from_string( std::string filter,
     }
     const bool exclude = filter[0] == '-';
     if( exclude ) {
-        return [filter, basic_filter]( const T & i ) {
-            return !filter_from_string( filter.substr( 1 ), basic_filter )( i );
+        return [included = filter_from_string( filter.substr( 1 ), basic_filter )]( const T & i ) {
+            return !included( i );
         };
     }
 
@@ -79,6 +79,22 @@ using segment_bitset = enum_bitset<tname::segments>;
 std::string print_segment( tname::segments segment, item const &it, unsigned int quantity,
                            segment_bitset const &segments );
 
+/**
+ * While at least one of these is alive, item::tname() results are memoized per item,
+ * quantity and segments.  Each entry also remembers a fingerprint of the item's state
+ * (type, charges, damage, flags, vars, contents, current turn and language), so an item
+ * that changes meanwhile is simply named again.
+ * Meant for UI code that sorts, filters and redraws the same items over and over.
+ */
+class name_cache_scope
+{
+    public:
+        name_cache_scope();
+        ~name_cache_scope();
+        name_cache_scope( const name_cache_scope & ) = delete;
+        name_cache_scope &operator=( const name_cache_scope & ) = delete;
+};
+
 #endif // CATA_IN_TOOL
 } // namespace tname
 
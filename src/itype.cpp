@@ -163,6 +163,13 @@ bool itype::has_use() const
 
 bool itype::has_flag( const flag_id &flag ) const
 {
+    if( !item_tags_mask.empty() ) {
+        // Undefined flags share the null int id, so a hit still has to be confirmed below.
+        const std::size_t i = flag.id().to_i();
+        if( i >= item_tags_mask.size() || !item_tags_mask[i] ) {
+            return false;
+        }
+    }
     return item_tags.count( flag );
 }
 
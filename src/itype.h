@@ -1361,6 +1361,9 @@ struct itype {
         mtype_id source_monster = mtype_id::NULL_ID();
     private:
         FlagsSetType item_tags;
+        // item_tags indexed by the int ids of the flags, filled in Item_factory::finalize_post.
+        // Lets has_flag reject flags the type does not have without searching item_tags.
+        std::vector<bool> item_tags_mask;
 
     public:
         // memory card related per-type static data
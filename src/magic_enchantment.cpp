@@ -1,5 +1,6 @@
 #include "magic_enchantment.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <set>
 #include <string>
@@ -15,6 +16,7 @@
 #include "enum_conversions.h"
 #include "enums.h"
 #include "generic_factory.h"
+#include "hash_utils.h"
 #include "item.h"
 #include "json.h"
 #include "map.h"
@@ -312,6 +314,20 @@ bool enchantment::is_active( const monster &mon ) const
     return false;
 }
 
+bool enchantment::depends_on_dialogue() const
+{
+    if( active_conditions.second == condition::DIALOG_CONDITION ) {
+        return true;
+    }
+    const auto is_variable = []( const auto &pair_values ) {
+        return !pair_values.second.is_constant();
+    };
+    return std::any_of( values_add.begin(), values_add.end(), is_variable ) ||
+           std::any_of( values_multiply.begin(), values_multiply.end(), is_variable ) ||
+           std::any_of( skill_values_add.begin(), skill_values_add.end(), is_variable ) ||
+           std::any_of( skill_values_multiply.begin(), skill_values_multiply.end(), is_variable );
+}
+
 // Returns true if this enchantment is relevant to monsters. Enchantments that are not relevant to monsters are not processed by monsters.
 bool enchantment::is_monster_relevant() const
 {
@@ -1129,3 +1145,25 @@ bool enchant_cache::operator==( const enchant_cache &rhs ) const
     return this->id == rhs.id &&
            this->get_mutations() == rhs.get_mutations();
 }
+
+std::size_t enchant_cache::hash() const
+{
+    std::size_t seed = std::hash<enchantment_id>()( id );
+    for( const std::pair<const enchant_vals::mod, double> &val : values_add ) {
+        cata::hash_combine( seed, val.first );
+        cata::hash_combine( seed, val.second );
+    }
+    for( const std::pair<const enchant_vals::mod, double> &val : values_multiply ) {
+        cata::hash_combine( seed, val.first );
+        cata::hash_combine( seed, val.second );
+    }
+    for( const std::pair<const skill_id, int> &val : skill_values_add ) {
+        cata::hash_combine( seed, val.first );
+        cata::hash_combine( seed, val.second );
+    }
+    for( const std::pair<const skill_id, int> &val : skill_values_multiply ) {
+        cata::hash_combine( seed, val.first );
+        cata::hash_combine( seed, val.second );
+    }
+    return seed;
+}
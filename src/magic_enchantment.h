@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_MAGIC_ENCHANTMENT_H
 #define CATA_SRC_MAGIC_ENCHANTMENT_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <map>
 #include <new>
@@ -227,6 +228,10 @@ class enchantment
 
         bool is_monster_relevant() const;
 
+        // whether the condition or any of the values depend on dialogue state, which means
+        // the enchantment has to be re-evaluated even if its source did not change.
+        bool depends_on_dialogue() const;
+
         // this enchantment is active when wielded.
         // shows total conditional values, so only use this when Character is not available
         bool active_wield() const;
@@ -339,6 +344,8 @@ class enchant_cache : public enchantment
         void load( const JsonObject &jo, std::string_view src = {},
                    const std::optional<std::string> &inline_id = std::nullopt );
         bool operator==( const enchant_cache &rhs ) const;
+        // hash of the id and the values, so that differently rolled copies hash differently
+        std::size_t hash() const;
 
         // details of each enchantment that includes them (name and description)
         std::vector<std::pair<std::string, std::string>> details; // NOLINT(cata-serialize)
@@ -4,6 +4,7 @@
 #include <array>
 #include <climits>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <optional>
 #include <ostream>
@@ -1461,6 +1462,7 @@ void map::unboard_vehicle( const tripoint_bub_ms &p, bool dead_passenger )
 bool map::displace_vehicle( vehicle &veh, const tripoint_rel_ms &dp, const bool adjust_pos,
                             const std::set<int> &parts_to_move )
 {
+    bump_items_revision();
     const tripoint_bub_ms src = veh.pos_bub();
     // handle vehicle ramps
     int ramp_offset = 0;
@@ -1780,6 +1782,7 @@ bool map::furn_set( const tripoint &p, const furn_id &new_furniture, const bool
 bool map::furn_set( const tripoint_bub_ms &p, const furn_id &new_furniture, const bool furn_reset,
                     bool avoid_creatures )
 {
+    bump_items_revision();
     if( !inbounds( p ) ) {
         debugmsg( "map::furn_set %s out of bounds", p.to_string() );
         return false;
@@ -2299,6 +2302,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain, bool avoid_crea
 
 bool map::ter_set( const tripoint_bub_ms &p, const ter_id &new_terrain, bool avoid_creatures )
 {
+    bump_items_revision();
     if( !inbounds( p ) ) {
         return false;
     }
@@ -5255,6 +5259,18 @@ map_stack map::i_at( const tripoint_bub_ms &p )
     return map_stack{ &current_submap->get_items( l ), p.raw(), this};
 }
 
+static std::uint64_t items_revision_counter = 0;
+
+std::uint64_t map::items_revision()
+{
+    return items_revision_counter;
+}
+
+void map::bump_items_revision()
+{
+    ++items_revision_counter;
+}
+
 map_stack::iterator map::i_rem( const tripoint &p, const map_stack::const_iterator &it )
 {
 
@@ -5263,6 +5279,7 @@ map_stack::iterator map::i_rem( const tripoint &p, const map_stack::const_iterat
 
 map_stack::iterator map::i_rem( const tripoint_bub_ms &p, const map_stack::const_iterator &it )
 {
+    bump_items_revision();
     point_sm_ms l;
     submap *const current_submap = get_submap_at( p, l );
     if( current_submap == nullptr ) {
@@ -5297,6 +5314,7 @@ void map::i_clear( const tripoint &p )
 
 void map::i_clear( const tripoint_bub_ms &p )
 {
+    bump_items_revision();
     point_sm_ms l;
     submap *const current_submap = get_submap_at( p, l );
     if( current_submap == nullptr ) {
@@ -5478,6 +5496,7 @@ std::pair<item *, tripoint_bub_ms> map::_add_item_or_charges( const tripoint_bub
         {
             for( item &e : i_at( tile ) ) {
                 if( e.merge_charges( obj ) ) {
+                    bump_items_revision();
                     return e;
                 }
             }
@@ -5587,6 +5606,7 @@ item &map::add_item( const tripoint_bub_ms &p, item new_item )
 
 item &map::add_item( const tripoint_bub_ms &p, item new_item, int copies )
 {
+    bump_items_revision();
     if( item_is_blacklisted( new_item.typeId() ) ) {
         return null_item_reference();
     }
@@ -5955,11 +5975,12 @@ void map::process_items_in_submap( submap &current_submap, const tripoint_rel_sm
 std::vector<item_reference> map::item_network_connections( vehicle *power_grid )
 {
     std::vector<item_reference> result;
+    std::vector<item_reference> active_items;
     for( const auto &iter : submaps_with_active_items ) {
         tripoint_abs_sm const abs_pos = iter;
         const tripoint_rel_sm local_pos = abs_pos - abs_sub.xy();
         submap *const current_submap = get_submap_at_grid( local_pos );
-        std::vector<item_reference> active_items = current_submap->active_items.get_for_processing();
+        current_submap->active_items.get_for_processing( active_items );
         for( item_reference &active_item_ref : active_items ) {
             if( !active_item_ref.item_ref ) {
                 continue;
@@ -6178,6 +6199,7 @@ std::list<item> use_amount_stack( Stack stack, const itype_id &type, int &quanti
 std::list<item> map::use_amount_square( const tripoint_bub_ms &p, const itype_id &type,
                                         int &quantity, const std::function<bool( const item & )> &filter )
 {
+    bump_items_revision();
     std::list<item> ret;
     // Handle infinite map sources.
     item water = liquid_from( p );
@@ -6239,6 +6261,7 @@ std::list<item> map::use_amount( const std::vector<tripoint_bub_ms> &reachable_p
                                  const itype_id &type,
                                  int &quantity, const std::function<bool( const item & )> &filter, bool select_ind )
 {
+    bump_items_revision();
     std::list<item> ret;
     if( select_ind && !type->count_by_charges() ) {
         std::vector<item_location> locs;
@@ -6371,6 +6394,7 @@ std::list<item> map::use_charges( const std::vector<tripoint_bub_ms> &reachable_
                                   const std::function<bool( const item & )> &filter,
                                   basecamp *bcp, bool in_tools )
 {
+    bump_items_revision();
     std::list<item> ret;
 
     // We prefer infinite map sources where available, so search for those
@@ -6773,6 +6797,7 @@ int map::set_field_intensity( const tripoint_bub_ms &p, const field_type_id &typ
                               const int new_intensity,
                               bool isoffset )
 {
+    bump_items_revision();
     field_entry *field_ptr = get_field( p, type );
     if( field_ptr != nullptr ) {
         int adj = ( isoffset && field_ptr->is_field_alive() ?
@@ -6885,6 +6910,7 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
 bool map::add_field( const tripoint_bub_ms &p, const field_type_id &type_id, int intensity,
                      const time_duration &age, bool hit_player )
 {
+    bump_items_revision();
     if( !inbounds( p ) ) {
         return false;
     }
@@ -6955,6 +6981,7 @@ void map::remove_field( const tripoint_bub_ms &p, const field_type_id &field_to_
 
 void map::delete_field( const tripoint_bub_ms &p, const field_type_id &field_to_remove )
 {
+    bump_items_revision();
     submap *current_submap = this->unsafe_get_submap_at( p );
     field &curfield = this->get_field( p );
 
@@ -6986,6 +7013,8 @@ void map::clear_fields( const tripoint_bub_ms &p )
 
 void map::on_field_modified( const tripoint_bub_ms &p, const field_type &fd_type )
 {
+    // Fields provide pseudo items like fire to the crafting inventory
+    bump_items_revision();
     invalidate_max_populated_zlev( p.z() );
 
     get_cache( p.z() ).field_cache.set(
@@ -8421,6 +8450,7 @@ shift_bitset_cache<MAPSIZE, 1>( std::bitset<MAPSIZE *MAPSIZE> &cache, const poin
 
 void map::shift( const point_rel_sm &sp )
 {
+    bump_items_revision();
     if( !zlevels ) {
         debugmsg( "map::shift called from map that doesn't support Z levels" );
         return;
@@ -8629,6 +8659,7 @@ bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type
 
 void map::loadn( const point_bub_sm &grid, bool update_vehicles )
 {
+    bump_items_revision();
     dbg( D_INFO ) << "map::loadn(game[" << g.get() << "], worldx[" << abs_sub.x()
                   << "], worldy[" << abs_sub.y() << "], grid " << grid << ")";
 
@@ -1472,6 +1472,13 @@ class map
         // TODO: fix point types (remove the first overload)
         void i_rem( const tripoint &p, item *it );
         void i_rem( const tripoint_bub_ms &p, item *it );
+        /**
+         * Revision counter shared by all maps, bumped whenever items, furniture, terrain,
+         * fields or vehicles change. Lets summaries of nearby items (like the crafting
+         * inventory) tell whether they are still current without rescanning.
+         */
+        static std::uint64_t items_revision();
+        static void bump_items_revision();
         void spawn_artifact( const tripoint_bub_ms &p, const relic_procgen_id &id, int max_attributes = 5,
                              int power_level = 1000, int max_negative_power = -2000, bool is_resonant = false );
         // TODO: Get rid of untyped overload
@@ -3261,7 +3261,7 @@ void monster::spawn_dissectables_on_death( item *corpse ) const
                                          calendar::turn,
                                          spawn_flags::use_spawn_rate );
         for( item &dissectable : dissectables ) {
-            dissectable.dropped_from = entry.type;
+            dissectable.set_dropped_from( entry.type );
             for( const flag_id &flg : entry.flags ) {
                 dissectable.set_flag( flg );
             }
@@ -4314,7 +4314,8 @@ void mongroup::wander( const overmap &om )
 void overmap::move_hordes()
 {
     // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype( zg ) tmpzg;
+    // The map nodes are re-keyed and re-inserted, so the monsters of a horde are never copied.
+    std::vector<decltype( zg )::node_type> moved_hordes;
     //MOVE ZOMBIE GROUPS
     for( auto it = zg.begin(); it != zg.end(); ) {
         mongroup &mg = it->second;
@@ -4370,15 +4371,17 @@ void overmap::move_hordes()
                 mg.abs_pos.y()++;
             }
 
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.emplace( mg.rel_pos(), mg );
-            zg.erase( it++ );
+            // Take the group out of its old location, it gets the new location as its key
+            decltype( zg )::node_type &moved = moved_hordes.emplace_back( zg.extract( it++ ) );
+            moved.key() = moved.mapped().rel_pos();
         } else {
             ++it;
         }
     }
     // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    for( decltype( zg )::node_type &moved : moved_hordes ) {
+        zg.insert( std::move( moved ) );
+    }
 
     if( get_option<bool>( "WANDER_SPAWNS" ) ) {
 
@@ -4444,11 +4447,12 @@ void overmap::move_hordes()
                     tripoint_abs_sm abs_pos = project_combine( pos(), p );
                     mongroup m( GROUP_ZOMBIE, abs_pos, 0 );
                     m.horde = true;
-                    m.monsters.push_back( this_monster );
+                    // The monster is erased below, so it can be moved into the horde.
+                    m.monsters.push_back( std::move( this_monster ) );
                     m.interest = 0; // Ensures that we will select a new target.
                     add_mon_group( m );
                 } else {
-                    add_to_group->monsters.push_back( this_monster );
+                    add_to_group->monsters.push_back( std::move( this_monster ) );
                 }
             } else { // Bad luck--the zombie would have joined a larger horde, but not this one.  Skip.
                 // Don't delete the monster, just increment the iterator.
@@ -8,6 +8,7 @@
 #include <optional>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include "basecamp.h"
 #include "calendar.h"
@@ -1598,8 +1599,9 @@ void overmapbuffer::spawn_monster( const tripoint_abs_sm &p, bool spawn_nonlocal
         if( !spawn_nonlocal ) {
             cata_assert( here.inbounds( local ) );
         }
-        monster *const placed = g->place_critter_around( make_shared_fast<monster>( this_monster ),
-                                local.raw(), 0, true );
+        // The bucket is erased below, so the stored monster can be moved out instead of copied.
+        monster *const placed = g->place_critter_around( make_shared_fast<monster>( std::move(
+                                    this_monster ) ), local.raw(), 0, true );
         if( placed ) {
             placed->on_load();
         }
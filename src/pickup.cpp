@@ -323,6 +323,7 @@ static bool pick_one_up( item_location &loc, int quantity, bool &got_water, bool
         // due to merging.
         if( orig_it.charges > newit.charges ) {
             orig_it.charges -= newit.charges;
+            loc.on_contents_changed();
         } else {
             loc.remove_item();
         }
@@ -580,6 +580,7 @@ static cata::value_ptr<parameterized_build_reqs> calculate_all_blueprint_reqs(
 
 void recipe::finalize()
 {
+    component_filter_traits_.reset();
     if( bp_autocalc ) {
         bp_build_reqs = calculate_all_blueprint_reqs( blueprint, bp_parameter_names );
     } else if( test_mode && check_blueprint_needs ) {
@@ -764,10 +765,8 @@ std::vector<item> recipe::create_result( bool set_components, bool is_food,
         return { newit };
     } else {
         std::vector<item> items;
+        // Every copy carries the same split of the components, so they share one list
         for( int i = 0; i < amount; i++ ) {
-            if( set_components ) {
-                set_new_comps( newit, amount, used, is_food, is_cooked );
-            }
             items.push_back( newit );
         }
         return items;
@@ -1257,12 +1256,21 @@ bool recipe::will_be_blacklisted() const
 std::function<bool( const item & )> recipe::get_component_filter(
     const recipe_filter_flags flags ) const
 {
-    const item result( result_ );
-
-    // Disallow crafting of non-perishables with rotten components
-    // Make an exception for items with the ALLOW_ROTTEN flag such as seeds
-    const bool recipe_forbids_rotten =
-        result.is_food() && !result.goes_bad() && !has_flag( "ALLOW_ROTTEN" );
+    // Building the result item is costly and the crafting menu asks for several filters
+    // per recipe, so work out what we need from it once.
+    if( !component_filter_traits_ ) {
+        const item result( result_ );
+        component_filter_traits traits;
+        // Disallow crafting of non-perishables with rotten components
+        // Make an exception for items with the ALLOW_ROTTEN flag such as seeds
+        traits.forbids_rotten = result.is_food() && !result.goes_bad() &&
+                                !has_flag( "ALLOW_ROTTEN" );
+        // If the result is made hot, we can allow frozen components.
+        traits.forbids_frozen = result.has_temperature() && !hot_result();
+        component_filter_traits_ = traits;
+    }
+
+    const bool recipe_forbids_rotten = component_filter_traits_->forbids_rotten;
     const bool flags_forbid_rotten =
         static_cast<bool>( flags & recipe_filter_flags::no_rotten );
     const bool flags_forbid_favorites =
@@ -1282,11 +1290,10 @@ std::function<bool( const item & )> recipe::get_component_filter(
         };
     }
 
-    // If the result is made hot, we can allow frozen components.
     // EDIBLE_FROZEN components ( e.g. flour, chocolate ) are allowed as well
     // Otherwise forbid them
     std::function<bool( const item & )> frozen_filter = return_true<item>;
-    if( result.has_temperature() && !hot_result() ) {
+    if( component_filter_traits_->forbids_frozen ) {
         frozen_filter = []( const item & component ) {
             return !component.has_flag( flag_FROZEN ) || component.has_flag( flag_EDIBLE_FROZEN );
         };
@@ -346,6 +346,13 @@ class recipe
         /** Deduped version constructed from the above requirements_ */
         deduped_requirement_data deduped_requirements_;
 
+        /** Result properties used by get_component_filter, worked out on first use */
+        struct component_filter_traits {
+            bool forbids_rotten = false;
+            bool forbids_frozen = false;
+        };
+        mutable std::optional<component_filter_traits> component_filter_traits_;
+
         std::set<std::string> flags;
 
         /** If set (zero or positive) set charges of output result for items counted by charges */
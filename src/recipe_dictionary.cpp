@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 
@@ -22,6 +23,7 @@
 #include "output.h"
 #include "requirements.h"
 #include "skill.h"
+#include "translation_cache.h"
 #include "uistate.h"
 #include "units.h"
 #include "value_ptr.h"
@@ -86,28 +88,127 @@ const recipe &recipe_dictionary::get_craft( const itype_id &id )
     return iter != recipe_dict.recipes.end() ? iter->second : null_recipe;
 }
 
-// searches for left-anchored partial match in the relevant recipe requirements set
-template <class group>
-bool search_reqs( const group &gp, const std::string_view txt )
+namespace
 {
-    return std::any_of( gp.begin(), gp.end(), [&]( const typename group::value_type & opts ) {
-        return std::any_of( opts.begin(),
-        opts.end(), [&]( const typename group::value_type::value_type & e ) {
-            return lcmatch( e.to_string(), txt );
-        } );
-    } );
-}
-// template specialization to make component searches easier
-template<>
-bool search_reqs( const std::vector<std::vector<item_comp> > &gp,
-                  const std::string_view txt )
+
+// Translated texts of the recipe fields searched by name, skill, component, tool and
+// quality. Many recipes share the same texts (component names in particular), so each
+// distinct text is stored and converted for lcmatch once, and a search tests it once.
+class recipe_search_index
 {
-    return std::any_of( gp.begin(), gp.end(), [&]( const std::vector<item_comp> &opts ) {
-        return std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
-            return lcmatch( item::nname( ic.type ), txt );
-        } );
-    } );
-}
+    public:
+        using text_ids = std::vector<int>;
+
+        struct recipe_texts {
+            int result_name = -1;
+            int primary_skill = -1;
+            text_ids skills;
+            text_ids components;
+            text_ids tools;
+            text_ids qualities;
+        };
+
+        const recipe_texts &texts_of( const recipe &r ) {
+            if( language_version != detail::get_current_language_version() ) {
+                clear();
+                language_version = detail::get_current_language_version();
+            }
+            auto it = recipes.find( &r );
+            if( it == recipes.end() ) {
+                it = recipes.emplace( &r, build( r ) ).first;
+            }
+            return it->second;
+        }
+
+        void clear() {
+            texts.clear();
+            text_lookup.clear();
+            recipes.clear();
+        }
+
+        /** Per-search cache of which texts matched, indexed like texts. */
+        class query
+        {
+            public:
+                query( const recipe_search_index &index, const std::string_view txt ) :
+                    index( index ), qry( lcmatch_query( txt ) ) {}
+
+                bool matches( const int id ) {
+                    if( static_cast<size_t>( id ) >= verdicts.size() ) {
+                        verdicts.resize( index.texts.size(), unknown );
+                    }
+                    if( verdicts[id] == unknown ) {
+                        verdicts[id] = index.texts[id].matches( qry ) ? matched : unmatched;
+                    }
+                    return verdicts[id] == matched;
+                }
+
+                bool matches_any( const text_ids &ids ) {
+                    return std::any_of( ids.begin(), ids.end(), [this]( const int id ) {
+                        return matches( id );
+                    } );
+                }
+
+            private:
+                static constexpr char unknown = 0;
+                static constexpr char matched = 1;
+                static constexpr char unmatched = 2;
+
+                const recipe_search_index &index;
+                std::u32string qry;
+                std::vector<char> verdicts;
+        };
+
+    private:
+        int intern( const std::string &text ) {
+            auto it = text_lookup.find( text );
+            if( it == text_lookup.end() ) {
+                it = text_lookup.emplace( text, static_cast<int>( texts.size() ) ).first;
+                texts.emplace_back( text );
+            }
+            return it->second;
+        }
+
+        template<typename T>
+        void add_reqs( text_ids &ids, const std::vector<std::vector<T>> &group ) {
+            for( const std::vector<T> &opts : group ) {
+                for( const T &e : opts ) {
+                    ids.push_back( intern( e.to_string() ) );
+                }
+            }
+        }
+
+        recipe_texts build( const recipe &r ) {
+            recipe_texts ret;
+            ret.result_name = intern( r.result_name() );
+            ret.primary_skill = intern( r.skill_used->name() );
+            ret.skills.reserve( r.required_skills.size() + 1 );
+            if( r.skill_used ) {
+                ret.skills.push_back( ret.primary_skill );
+            }
+            for( const std::pair<const skill_id, int> &e : r.required_skills ) {
+                ret.skills.push_back( intern( e.first->name() ) );
+            }
+            const requirement_data &reqs = r.simple_requirements();
+            for( const std::vector<item_comp> &opts : reqs.get_components() ) {
+                for( const item_comp &ic : opts ) {
+                    ret.components.push_back( intern( item::nname( ic.type ) ) );
+                }
+            }
+            add_reqs( ret.tools, reqs.get_tools() );
+            add_reqs( ret.qualities, reqs.get_qualities() );
+            return ret;
+        }
+
+        int language_version = INVALID_LANGUAGE_VERSION;
+        std::vector<lcmatch_text> texts;
+        std::unordered_map<std::string, int> text_lookup;
+        std::unordered_map<const recipe *, recipe_texts> recipes;
+};
+
+recipe_search_index search_index;
+
+} // namespace
 
 std::vector<const recipe *> recipe_subset::favorite() const
 {
@@ -170,38 +271,32 @@ std::vector<const recipe *> recipe_subset::search(
     const std::string_view txt, const search_type key,
     const std::function<void( size_t, size_t )> &progress_callback ) const
 {
+    recipe_search_index::query indexed( search_index, txt );
     auto predicate = [&]( const recipe * r ) {
         if( !*r || r->obsolete ) {
             return false;
         }
         switch( key ) {
             case search_type::name:
-                return lcmatch( r->result_name(), txt );
+                return indexed.matches( search_index.texts_of( *r ).result_name );
 
             case search_type::exclude_name:
-                return !lcmatch( r->result_name(), txt );
+                return !indexed.matches( search_index.texts_of( *r ).result_name );
 
-            case search_type::skill: {
-                if( r->skill_used && lcmatch( r->skill_used->name(), txt ) ) {
-                    return true;
-                }
-                const auto &skills = r->required_skills;
-                return std::any_of( skills.begin(), skills.end(), [&]( const std::pair<skill_id, int> &e ) {
-                    return lcmatch( e.first->name(), txt );
-                } );
-            }
+            case search_type::skill:
+                return indexed.matches_any( search_index.texts_of( *r ).skills );
 
             case search_type::primary_skill:
-                return lcmatch( r->skill_used->name(), txt );
+                return indexed.matches( search_index.texts_of( *r ).primary_skill );
 
             case search_type::component:
-                return search_reqs( r->simple_requirements().get_components(), txt );
+                return indexed.matches_any( search_index.texts_of( *r ).components );
 
             case search_type::tool:
-                return search_reqs( r->simple_requirements().get_tools(), txt );
+                return indexed.matches_any( search_index.texts_of( *r ).tools );
 
             case search_type::quality:
-                return search_reqs( r->simple_requirements().get_qualities(), txt );
+                return indexed.matches_any( search_index.texts_of( *r ).qualities );
 
             case search_type::quality_result: {
                 return item::find_type( r->result() )->has_any_quality( txt );
@@ -556,6 +651,7 @@ void recipe_dictionary::find_items_on_loops()
 void recipe_dictionary::finalize()
 {
     DynamicDataLoader::get_instance().load_deferred( deferred );
+    search_index.clear();
 
     // remove abstract recipes
     delete_if( []( const recipe & element ) {
@@ -700,6 +796,7 @@ void recipe_dictionary::reset()
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
     recipe_dict.items_on_loops.clear();
+    search_index.clear();
     for( std::pair<JsonObject, std::string> &deferred_json : deferred ) {
         deferred_json.first.allow_omitted_members();
     }
@@ -710,6 +807,7 @@ void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &
 {
     ::delete_if( recipe_dict.recipes, pred );
     ::delete_if( recipe_dict.uncraft, pred );
+    search_index.clear();
 }
 
 void recipe_subset::include( const recipe *r, int custom_difficulty )
@@ -1807,6 +1807,7 @@ void npc::import_and_clean( const JsonObject &data )
     last_updated = defaults.last_updated;
     lifespan_end = defaults.lifespan_end;
     effects->clear();
+    effect_flags_dirty = true;
     consumption_history = defaults.consumption_history;
     last_sleep_check = defaults.last_sleep_check;
     queued_effect_on_conditions = defaults.queued_effect_on_conditions;
@@ -2565,30 +2565,55 @@ void monster::serialize( JsonOut &json ) const
 void monster::store( JsonOut &json ) const
 {
     Creature::store( json );
+    // Monsters outside the reality bubble are stored in bulk on the overmap, so members that
+    // are at the value load() assumes when they are absent (mostly the mtype defaults) are
+    // omitted to keep the stored record small.
     json.member( "typeid", type->id );
-    json.member( "unique_name", unique_name );
-    json.member( "nickname", nickname );
-    json.member( "goal", goal );
+    if( !unique_name.empty() ) {
+        json.member( "unique_name", unique_name );
+    }
+    if( !nickname.empty() ) {
+        json.member( "nickname", nickname );
+    }
+    if( goal ) {
+        json.member( "goal", goal );
+    }
     json.member( "wander_pos", wander_pos );
     json.member( "wandf", wandf );
-    json.member( "provocative_sound", provocative_sound );
+    if( provocative_sound ) {
+        json.member( "provocative_sound", provocative_sound );
+    }
     if( !patrol_route.empty() ) {
         json.member( "patrol_route", patrol_route );
         json.member( "next_patrol_point", next_patrol_point );
     }
     json.member( "hp", hp );
     json.member( "special_attacks", special_attacks );
-    json.member( "friendly", friendly );
+    if( friendly != 0 ) {
+        json.member( "friendly", friendly );
+    }
     json.member( "fish_population", fish_population );
     json.member( "faction", faction.id().str() );
-    json.member( "mission_ids", mission_ids );
-    json.member( "mission_fused", mission_fused );
-    json.member( "no_extra_death_drops", no_extra_death_drops );
-    json.member( "dead", dead );
+    if( !mission_ids.empty() ) {
+        json.member( "mission_ids", mission_ids );
+    }
+    if( !mission_fused.empty() ) {
+        json.member( "mission_fused", mission_fused );
+    }
+    if( no_extra_death_drops ) {
+        json.member( "no_extra_death_drops", no_extra_death_drops );
+    }
+    if( dead ) {
+        json.member( "dead", dead );
+    }
     json.member( "anger", anger );
     json.member( "morale", morale );
-    json.member( "hallucination", hallucination );
-    json.member( "aggro_character", aggro_character );
+    if( hallucination ) {
+        json.member( "hallucination", hallucination );
+    }
+    if( !aggro_character ) {
+        json.member( "aggro_character", aggro_character );
+    }
     if( tied_item ) {
         json.member( "tied_item", *tied_item );
     }
@@ -2604,28 +2629,50 @@ void monster::store( JsonOut &json ) const
     if( battery_item ) {
         json.member( "battery_item", *battery_item );
     }
-    json.member( "ammo", ammo );
+    if( !ammo.empty() ) {
+        json.member( "ammo", ammo );
+    }
     json.member( "underwater", underwater );
-    json.member( "upgrades", upgrades );
-    json.member( "upgrade_time", upgrade_time );
-    json.member( "reproduces", reproduces );
-    json.member( "baby_timer", baby_timer );
-    json.member( "biosignatures", biosignatures );
+    if( upgrades != type->upgrades ) {
+        json.member( "upgrades", upgrades );
+    }
+    if( upgrade_time != -1 ) {
+        json.member( "upgrade_time", upgrade_time );
+    }
+    if( reproduces != type->reproduces ) {
+        json.member( "reproduces", reproduces );
+    }
+    if( baby_timer ) {
+        json.member( "baby_timer", baby_timer );
+    }
+    if( biosignatures != type->biosignatures ) {
+        json.member( "biosignatures", biosignatures );
+    }
     json.member( "biosig_timer", biosig_timer );
     json.member( "udder_timer", udder_timer );
 
     if( horde_attraction > MHA_NULL && horde_attraction < NUM_MONSTER_HORDE_ATTRACTION ) {
         json.member( "horde_attraction", horde_attraction );
     }
-    json.member( "inv", inv );
-    json.member( "dissectable_inv", dissectable_inv );
+    if( !inv.empty() ) {
+        json.member( "inv", inv );
+    }
+    if( !dissectable_inv.empty() ) {
+        json.member( "dissectable_inv", dissectable_inv );
+    }
 
-    json.member( "dragged_foe_id", dragged_foe_id );
+    if( dragged_foe_id.is_valid() ) {
+        json.member( "dragged_foe_id", dragged_foe_id );
+    }
     // storing the rider
-    json.member( "mounted_player_id", mounted_player_id );
+    if( mounted_player_id.is_valid() ) {
+        json.member( "mounted_player_id", mounted_player_id );
+    }
 
     // store grabbed limbs
-    json.member( "grabbed_limbs", grabbed_limbs );
+    if( !grabbed_limbs.empty() ) {
+        json.member( "grabbed_limbs", grabbed_limbs );
+    }
 }
 
 void mon_special_attack::serialize( JsonOut &json ) const
@@ -2797,6 +2844,9 @@ void item::io( Archive &archive )
     archive.io( "energy", energy, 0_mJ );
 
     int cur_phase = static_cast<int>( current_phase );
+    std::string corpse_name = get_corpse_name();
+    faction_id old_owner = cold_ ? cold_->old_owner : faction_id::NULL_ID();
+    harvest_drop_type_id dropped_from = get_dropped_from();
     archive.io( "burnt", burnt, 0 );
     archive.io( "poison", poison, 0 );
     archive.io( "frequency", frequency, 0 );
@@ -2864,6 +2914,14 @@ void item::io( Archive &archive )
         }
     }
 
+    if( Archive::is_input::value ) {
+        if( corpse_name.empty() && old_owner.is_null() && dropped_from.is_null() ) {
+            cold_.reset();
+        } else {
+            cold_ = cata::make_value<cold_data>( cold_data{ corpse_name, old_owner, dropped_from } );
+        }
+    }
+
     item_controller->migrate_item( orig, *this );
 
     if( !Archive::is_input::value ) {
@@ -3757,6 +3815,7 @@ void Creature::load( const JsonObject &jsin )
     } else {
         jsin.read( "effects", *effects );
     }
+    effect_flags_dirty = true;
 
     jsin.read( "values", values );
     // potentially migrate some values
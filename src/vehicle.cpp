@@ -5975,6 +5975,7 @@ int vehicle::add_charges( vehicle_part &vp, const item &itm )
 
 std::optional<vehicle_stack::iterator> vehicle::add_item( vehicle_part &vp, const item &itm )
 {
+    map::bump_items_revision();
     // const int max_weight = ?! // TODO: weight limit, calculation per vpart & vehicle stats, not a hard user limit.
     // add creaking sounds and damage to overloaded vpart, outright break it past a certain point, or when hitting bumps etc
     if( vp.is_broken() ) {
@@ -6033,6 +6034,7 @@ bool vehicle::remove_item( vehicle_part &vp, item *it )
 vehicle_stack::iterator vehicle::remove_item( vehicle_part &vp,
         const vehicle_stack::const_iterator &it )
 {
+    map::bump_items_revision();
     invalidate_mass();
     return vp.items.erase( it );
 }
@@ -42,6 +42,7 @@ static const bionic_id bio_ups( "bio_ups" );
 static const itype_id itype_UPS( "UPS" );
 static const itype_id itype_apparatus( "apparatus" );
 
+static const quality_id qual_BOIL( "BOIL" );
 static const quality_id qual_BUTCHER( "BUTCHER" );
 static const quality_id qual_SMOKE_PIPE( "SMOKE_PIPE" );
 
@@ -104,18 +105,31 @@ static T sum_no_wrap( T a, T b )
     return a + b;
 }
 
+/**
+ * An item's quality already includes the best quality of everything it contains, so once an
+ * item falls short nothing inside it can do better. BOIL is the exception: a non-empty
+ * container loses its own BOIL quality while the items inside it keep theirs.
+ */
+static bool contents_bounded_by_container( const quality_id &qual )
+{
+    return qual != qual_BOIL;
+}
+
 template <typename T>
 static int has_quality_internal( const T &self, const quality_id &qual, int level, int limit )
 {
     int qty = 0;
+    const bool bounded = contents_bounded_by_container( qual );
 
-    self.visit_items( [&qual, level, &limit, &qty]( item * e, item * ) {
+    self.visit_items( [&qual, level, &limit, &qty, bounded]( item * e, item * ) {
         if( e->get_quality( qual ) >= level ) {
             qty = sum_no_wrap( qty, static_cast<int>( e->count() ) );
             if( qty >= limit ) {
                 // found sufficient items
                 return VisitResponse::ABORT;
             }
+        } else if( bounded ) {
+            return VisitResponse::SKIP;
         }
         return VisitResponse::NEXT;
     } );
@@ -152,19 +166,33 @@ bool read_only_visitable::has_quality( const quality_id &qual, int level, int qt
 /** @relates visitable */
 bool inventory::has_quality( const quality_id &qual, int level, int qty ) const
 {
-    const quality_query query{ qual, level, qty };
-
-    if( qualities_cache.find( query ) == qualities_cache.end() ) {
-        int res = 0;
-        for( const auto &stack : this->items ) {
-            res += stack.size() * has_quality_internal( stack.front(), qual, level, qty );
-            if( res >= qty ) {
-                qualities_cache[query] = true;
-            }
+    // Rebinning after a change also drops the quality tables
+    get_binned_items();
+
+    auto levels = quality_levels.find( qual );
+    if( levels == quality_levels.end() ) {
+        levels = quality_levels.emplace( qual, std::map<int, int>() ).first;
+        for( const std::list<item> &stack : this->items ) {
+            const int stack_size = static_cast<int>( stack.size() );
+            stack.front().visit_items( [&qual, &levels, stack_size]( const item * e, item * ) {
+                const int found = e->get_quality( qual );
+                if( found != INT_MIN ) {
+                    int &count = levels->second[found];
+                    count = sum_no_wrap( count, static_cast<int>( e->count() ) * stack_size );
+                }
+                return VisitResponse::NEXT;
+            } );
         }
     }
 
-    return qualities_cache[query];
+    int res = 0;
+    for( auto it = levels->second.lower_bound( level ); it != levels->second.end(); ++it ) {
+        res = sum_no_wrap( res, it->second );
+        if( res >= qty ) {
+            return true;
+        }
+    }
+    return false;
 }
 
 /** @relates visitable */
@@ -230,9 +258,10 @@ template <typename T>
 static int max_quality_internal( const T &self, const quality_id &qual )
 {
     int res = INT_MIN;
-    self.visit_items( [&res, &qual]( item * e, item * ) {
+    const bool bounded = contents_bounded_by_container( qual );
+    self.visit_items( [&res, &qual, bounded]( item * e, item * ) {
         res = std::max( res, e->get_quality( qual ) );
-        return VisitResponse::NEXT;
+        return bounded ? VisitResponse::SKIP : VisitResponse::NEXT;
     } );
     return res;
 }
@@ -820,10 +849,9 @@ static int charges_of_internal( const T &self, const M &main, const itype_id &id
     bool found_tool_with_UPS = false;
     bool found_bionic_tool = false;
     self.visit_items( [&]( const item * e, item * ) {
-        if( filter( *e ) &&
-            ( id == e->typeId() || ( in_tools && id == e->ammo_current() ) ||
+        if( ( id == e->typeId() || ( in_tools && id == e->ammo_current() ) ||
               ( id == itype_UPS && e->has_flag( flag_IS_UPS ) ) ) &&
-            !e->is_broken() ) {
+            filter( *e ) && !e->is_broken() ) {
             if( id != itype_UPS ) {
                 if( e->count_by_charges() ) {
                     qty = sum_no_wrap( qty, e->charges );
@@ -919,10 +947,12 @@ int inventory::charges_of( const itype_id &what, int limit,
                            const std::function<void( int )> &visitor, bool in_tools ) const
 {
     const itype_bin &binned = get_binned_items();
-    const auto iter = std::find_if( binned.begin(),
-    binned.end(), [&what]( itype_bin::value_type const & it ) {
-        return it.first == what || ( what == itype_UPS && it.first->has_flag( flag_IS_UPS ) );
-    } );
+    auto iter = binned.find( what );
+    if( iter == binned.end() && what == itype_UPS ) {
+        iter = std::find_if( binned.begin(), binned.end(), []( itype_bin::value_type const & it ) {
+            return it.first->has_flag( flag_IS_UPS );
+        } );
+    }
     if( iter == binned.end() ) {
         return 0;
     }
@@ -958,9 +988,11 @@ static int amount_of_internal( const T &self, const itype_id &id, bool pseudo, i
                                const std::function<bool( const item & )> &filter )
 {
     int qty = 0;
-    self.visit_items( [&qty, &id, &pseudo, &limit, &filter]( const item * e, item * ) {
-        if( !e->has_flag( STATIC( flag_id( "ITEM_BROKEN" ) ) ) &&
-            ( id == STATIC( itype_id( "any" ) ) || e->typeId() == id ) && filter( *e ) &&
+    const bool any = id == STATIC( itype_id( "any" ) );
+    self.visit_items( [&qty, &id, &pseudo, &limit, &filter, any]( const item * e, item * ) {
+        // check the type first as it is much cheaper than the flag lookups
+        if( ( any || e->typeId() == id ) &&
+            !e->has_flag( STATIC( flag_id( "ITEM_BROKEN" ) ) ) && filter( *e ) &&
             ( pseudo || !e->has_flag( STATIC( flag_id( "PSEUDO" ) ) ) ) ) {
             qty = sum_no_wrap( qty, 1 );
         }
@@ -982,9 +982,25 @@ units::temperature weather_manager::get_temperature( const tripoint_abs_omt &loc
     return location.z() < 0 ? AVERAGE_ANNUAL_TEMPERATURE : temperature;
 }
 
+units::temperature weather_manager::get_weather_temperature( const tripoint &location,
+        const time_point &time )
+{
+    // The weather generator only looks at the x/y position
+    const std::pair<point, int> key( location.xy(), to_turns<int>( time - calendar::turn_zero ) );
+    const auto cached = weather_temperature_cache.find( key );
+    if( cached != weather_temperature_cache.end() ) {
+        return cached->second;
+    }
+    const units::temperature temp = get_cur_weather_gen().get_weather_temperature( location, time,
+                                    g->get_seed() );
+    weather_temperature_cache.emplace( key, temp );
+    return temp;
+}
+
 void weather_manager::clear_temp_cache()
 {
     temperature_cache.clear();
+    weather_temperature_cache.clear();
 }
 
 const weather_manager &get_weather_const()
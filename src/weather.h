@@ -8,6 +8,7 @@
 #include "catacharset.h"
 #include "color.h"
 #include "coords_fwd.h"
+#include "hash_utils.h"
 #include "pimpl.h"
 #include "point.h"
 #include "type_id.h"
@@ -227,6 +228,15 @@ class weather_manager
         units::temperature get_temperature( const tripoint &location );
         // Returns outdoor or indoor temperature of given location
         units::temperature get_temperature( const tripoint_abs_omt &location ) const;
+        /**
+         * weather generator temperature cache, cleared every turn, keyed by map x/y and turn.
+         * Items catching up on time spent outside the reality bubble share the same hourly
+         * history, so the noise is only evaluated once per location and hour.
+         */
+        std::unordered_map<std::pair<point, int>, units::temperature, cata::tuple_hash>
+        weather_temperature_cache;
+        // Returns the temperature the weather generator gives for location at time
+        units::temperature get_weather_temperature( const tripoint &location, const time_point &time );
         void clear_temp_cache();
         static void serialize_all( JsonOut &json );
         static void unserialize_all( const JsonObject &w );
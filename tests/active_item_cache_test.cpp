@@ -1,5 +1,10 @@
+#include <cstddef>
+#include <iterator>
+#include <list>
 #include <set>
+#include <vector>
 
+#include "active_item_cache.h"
 #include "calendar.h"
 #include "cata_catch.h"
 #include "game_constants.h"
@@ -40,3 +45,58 @@ TEST_CASE( "place_active_item_at_various_coordinates", "[item]" )
         }
     }
 }
+
+TEST_CASE( "active_item_cache_processes_every_item_in_turn", "[item]" )
+{
+    // Comestibles are processed every 10 minutes, so only a slice of them is returned per call.
+    std::list<item> items( 250, item( "meat_cooked" ) );
+    REQUIRE( items.front().processing_speed() == to_turns<int>( 10_minutes ) );
+    active_item_cache cache;
+    for( item &it : items ) {
+        REQUIRE( cache.add( it, point_rel_ms() ) );
+    }
+    REQUIRE( cache.get().size() == items.size() );
+
+    std::set<const item *> seen;
+    const std::size_t per_call = items.size() / items.front().processing_speed() + 1;
+    for( std::size_t i = 0; i < ( items.size() + per_call - 1 ) / per_call; ++i ) {
+        for( const item_reference &ref : cache.get_for_processing() ) {
+            seen.insert( ref.item_ref.get() );
+        }
+    }
+    CHECK( seen.size() == items.size() );
+
+    // Destroy every other item; the cache drops them and keeps the survivors exactly once.
+    bool destroy = true;
+    for( auto it = items.begin(); it != items.end(); destroy = !destroy ) {
+        it = destroy ? items.erase( it ) : std::next( it );
+    }
+    CHECK( cache.get().size() == items.size() );
+    for( item &it : items ) {
+        cache.add( it, point_rel_ms() );
+    }
+    CHECK( cache.get().size() == items.size() );
+    CHECK_FALSE( cache.empty() );
+
+    items.clear();
+    CHECK( cache.get().empty() );
+    CHECK( cache.empty() );
+}
+
+TEST_CASE( "active_item_cache_benchmark", "[.][item][benchmark]" )
+{
+    std::list<item> items( 5000, item( "meat_cooked" ) );
+    active_item_cache cache;
+    for( item &it : items ) {
+        cache.add( it, point_rel_ms() );
+    }
+    std::vector<item_reference> buffer;
+
+    BENCHMARK( "get_for_processing" ) {
+        cache.get_for_processing( buffer );
+        return buffer.size();
+    };
+    BENCHMARK( "get" ) {
+        return cache.get().size();
+    };
+}
@@ -409,3 +409,20 @@ TEST_CASE( "lcmatch", "[utility][nogame]" )
     CHECK( lcmatch( "無効", "無" ) == true );
     CHECK( lcmatch( "無効", "無效" ) == false );
 }
+
+TEST_CASE( "lcmatch_text_agrees_with_lcmatch", "[utility][nogame]" )
+{
+    const std::vector<std::string> subjects = {
+        "Bo", "Bö", "Bō", "BÖ", "BŌ", "«101 борцовский приём»", "無効"
+    };
+    const std::vector<std::string> queries = {
+        "", "bo", "bö", "bō", "co", "при", "прИ", "прб", "無", "無效"
+    };
+    for( const std::string &subject : subjects ) {
+        const lcmatch_text text( subject );
+        for( const std::string &query : queries ) {
+            CAPTURE( subject, query );
+            CHECK( text.matches( lcmatch_query( query ) ) == lcmatch( subject, query ) );
+        }
+    }
+}
@@ -17,9 +17,12 @@
 static const activity_id ACT_MOVE_LOOT( "ACT_MOVE_LOOT" );
 static const faction_id faction_your_followers( "your_followers" );
 
+static const furn_str_id furn_f_speaker_cabinet( "f_speaker_cabinet" );
+
 static const itype_id itype_556( "556" );
 static const itype_id itype_ammolink223( "ammolink223" );
 static const itype_id itype_belt223( "belt223" );
+static const itype_id itype_hammer( "hammer" );
 
 static const vproto_id vehicle_prototype_shopping_cart( "shopping_cart" );
 
@@ -27,6 +30,7 @@ static const zone_type_id zone_type_LOOT_DRINK( "LOOT_DRINK" );
 static const zone_type_id zone_type_LOOT_FOOD( "LOOT_FOOD" );
 static const zone_type_id zone_type_LOOT_PDRINK( "LOOT_PDRINK" );
 static const zone_type_id zone_type_LOOT_PFOOD( "LOOT_PFOOD" );
+static const zone_type_id zone_type_LOOT_TOOLS( "LOOT_TOOLS" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
 static const zone_type_id zone_type_UNLOAD_ALL( "UNLOAD_ALL" );
 
@@ -117,6 +121,46 @@ TEST_CASE( "zone_unloading_ammo_belts", "[zones][items][ammo_belt][activities][u
     }
 }
 
+TEST_CASE( "zone_sorting_fills_nearest_destination_first", "[zones][items][activities]" )
+{
+    avatar &dummy = get_avatar();
+    map &here = get_map();
+
+    clear_avatar();
+    clear_map();
+
+    const tripoint src = tripoint_east;
+    const tripoint near_dest = src + tripoint( 2, 0, 0 );
+    const tripoint far_dest = src + tripoint( 5, 0, 0 );
+    dummy.set_location( here.getglobal( src ) );
+
+    // Each destination holds 3750 ml, room for 11 hammers
+    for( const tripoint &dest : {
+             near_dest, far_dest
+         } ) {
+        here.furn_set( dest, furn_f_speaker_cabinet );
+        REQUIRE( here.free_volume( dest ) == 3750_ml );
+    }
+    // Create the far zone first, so the nearest one does not win by creation order
+    create_tile_zone( "Tools far", zone_type_LOOT_TOOLS, far_dest );
+    create_tile_zone( "Tools near", zone_type_LOOT_TOOLS, near_dest );
+    create_tile_zone( "Unsorted", zone_type_LOOT_UNSORTED, src );
+
+    const int hammers = 15;
+    for( int i = 0; i < hammers; ++i ) {
+        here.add_item( src, item( itype_hammer ) );
+    }
+    REQUIRE( zone_manager::get_manager().get_near_zone_type_for_item( item( itype_hammer ),
+             here.getglobal( src ) ) == zone_type_LOOT_TOOLS );
+
+    dummy.assign_activity( player_activity( ACT_MOVE_LOOT ) );
+    process_activity( dummy );
+
+    CHECK( count_items_or_charges( src, itype_hammer, std::nullopt ) == 0 );
+    CHECK( count_items_or_charges( near_dest, itype_hammer, std::nullopt ) == 11 );
+    CHECK( count_items_or_charges( far_dest, itype_hammer, std::nullopt ) == hammers - 11 );
+}
+
 // Comestibles sorting is a bit awkward. Unlike other loot, they're almost
 // always inside of a container, and their sort zone changes based on their
 // shelf life and whether the container prevents rotting.
@@ -8,9 +8,11 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "activity_actor_definitions.h"
 #include "activity_type.h"
 #include "avatar.h"
 #include "calendar.h"
@@ -18,9 +20,12 @@
 #include "cata_catch.h"
 #include "character.h"
 #include "craft_command.h"
+#include "field.h"
+#include "field_type.h"
 #include "game.h"
 #include "inventory.h"
 #include "item.h"
+#include "item_location.h"
 #include "itype.h"
 #include "map.h"
 #include "map_helpers.h"
@@ -52,14 +57,17 @@ static const flag_id json_flag_USE_UPS( "USE_UPS" );
 static const furn_str_id furn_f_smoking_rack( "f_smoking_rack" );
 
 static const itype_id itype_awl_bone( "awl_bone" );
+static const itype_id itype_backpack( "backpack" );
 static const itype_id itype_candle( "candle" );
 static const itype_id itype_cash_card( "cash_card" );
 static const itype_id itype_charcoal( "charcoal" );
 static const itype_id itype_chisel( "chisel" );
 static const itype_id itype_fake_anvil( "fake_anvil" );
+static const itype_id itype_fire( "fire" );
 static const itype_id itype_hacksaw( "hacksaw" );
 static const itype_id itype_hammer( "hammer" );
 static const itype_id itype_kevlar_shears( "kevlar_shears" );
+static const itype_id itype_nail( "nail" );
 static const itype_id itype_pockknife( "pockknife" );
 static const itype_id itype_sewing_kit( "sewing_kit" );
 static const itype_id itype_sheet_cotton( "sheet_cotton" );
@@ -209,6 +217,72 @@ TEST_CASE( "recipe_subset" )
     }
 }
 
+static std::vector<const recipe *> search_by_scanning( const recipe_subset &subset,
+        const std::string_view txt,
+        const std::function<std::vector<std::string>( const recipe & )> &texts )
+{
+    std::vector<const recipe *> res;
+    for( const recipe *r : subset ) {
+        if( !*r || r->obsolete ) {
+            continue;
+        }
+        const std::vector<std::string> searched = texts( *r );
+        if( std::any_of( searched.begin(), searched.end(), [&txt]( const std::string & text ) {
+        return lcmatch( text, txt );
+        } ) ) {
+            res.push_back( r );
+        }
+    }
+    return res;
+}
+
+TEST_CASE( "recipe_search_matches_every_recipe_text", "[recipes]" )
+{
+    recipe_subset subset;
+    for( const std::pair<const recipe_id, recipe> &rec : recipe_dict ) {
+        subset.include( &rec.second );
+    }
+    REQUIRE( subset.size() > 0 );
+
+    const auto names = []( const recipe & r ) {
+        return std::vector<std::string> { r.result_name() };
+    };
+    const auto components = []( const recipe & r ) {
+        std::vector<std::string> ret;
+        for( const std::vector<item_comp> &opts : r.simple_requirements().get_components() ) {
+            for( const item_comp &ic : opts ) {
+                ret.push_back( item::nname( ic.type ) );
+            }
+        }
+        return ret;
+    };
+    const auto tools = []( const recipe & r ) {
+        std::vector<std::string> ret;
+        for( const std::vector<tool_comp> &opts : r.simple_requirements().get_tools() ) {
+            for( const tool_comp &tc : opts ) {
+                ret.push_back( tc.to_string() );
+            }
+        }
+        return ret;
+    };
+
+    // Searching twice for the same text answers from the texts kept by the first search
+    for( int pass = 0; pass < 2; ++pass ) {
+        CAPTURE( pass );
+        for( const char *txt : {
+                 "", "rum", "Water", "nail", "a"
+             } ) {
+            CAPTURE( txt );
+            CHECK( subset.search( txt, recipe_subset::search_type::name ) ==
+                   search_by_scanning( subset, txt, names ) );
+            CHECK( subset.search( txt, recipe_subset::search_type::component ) ==
+                   search_by_scanning( subset, txt, components ) );
+            CHECK( subset.search( txt, recipe_subset::search_type::tool ) ==
+                   search_by_scanning( subset, txt, tools ) );
+        }
+    }
+}
+
 TEST_CASE( "available_recipes", "[recipes]" )
 {
     const recipe *r = &recipe_magazine_battery_light_mod.obj();
@@ -822,6 +896,118 @@ TEST_CASE( "UPS_modded_tools", "[crafting][ups]" )
     REQUIRE( tinv.charges_of( soldering_iron->typeId() ) == ammo_count );
 }
 
+TEST_CASE( "crafting_inventory_follows_nearby_item_changes", "[crafting][inventory]" )
+{
+    Character &c = get_player_character();
+    clear_avatar();
+    clear_map();
+    map &here = get_map();
+    const tripoint spot = c.pos() + tripoint_east;
+
+    REQUIRE( c.crafting_inventory().count_item( itype_hammer ) == 0 );
+
+    // Same turn and moves as the cached inventory, only the map changed
+    here.add_item_or_charges( spot, item( itype_hammer ) );
+    CHECK( c.crafting_inventory().count_item( itype_hammer ) == 1 );
+
+    c.mod_moves( -100 );
+    here.add_item_or_charges( spot, item( itype_hammer ) );
+    CHECK( c.crafting_inventory().count_item( itype_hammer ) == 2 );
+
+    // A new turn with no map changes keeps the nearby items
+    calendar::turn += 1_turns;
+    c.i_add( item( itype_chisel ) );
+    const inventory &inv = c.crafting_inventory();
+    CHECK( inv.count_item( itype_hammer ) == 2 );
+    CHECK( inv.count_item( itype_chisel ) == 1 );
+
+    here.i_clear( spot );
+    CHECK( c.crafting_inventory().count_item( itype_hammer ) == 0 );
+    CHECK( c.crafting_inventory().count_item( itype_chisel ) == 1 );
+}
+
+TEST_CASE( "crafting_inventory_follows_nearby_charges", "[crafting][inventory]" )
+{
+    Character &c = get_player_character();
+    clear_avatar();
+    clear_map();
+    map &here = get_map();
+    const tripoint spot = c.pos() + tripoint_east;
+
+    item &pile = here.add_item_or_charges( spot, item( itype_nail, calendar::turn, 10 ) );
+    REQUIRE( pile.charges == 10 );
+    REQUIRE( c.crafting_inventory().charges_of( itype_nail ) == 10 );
+    calendar::turn += 1_turns;
+
+    SECTION( "dropping onto an existing pile" ) {
+        here.add_item_or_charges( spot, item( itype_nail, calendar::turn, 5 ) );
+        REQUIRE( here.i_at( spot ).size() == 1 );
+        CHECK( c.crafting_inventory().charges_of( itype_nail ) == 15 );
+    }
+
+    SECTION( "picking up part of a pile" ) {
+        c.wear_item( item( itype_backpack ) );
+        const std::vector<item_location> targets = {
+            item_location( map_cursor( tripoint_bub_ms( spot ) ), &pile )
+        };
+        c.set_moves( 100 );
+        c.assign_activity( pickup_activity_actor( targets, { 4 }, c.pos_bub(), false ) );
+        c.activity.do_turn( c );
+        REQUIRE( c.charges_of( itype_nail ) == 4 );
+        REQUIRE( here.i_at( spot ).only_item().charges == 6 );
+        CHECK( c.crafting_inventory().charges_of( itype_nail ) == 10 );
+    }
+}
+
+TEST_CASE( "crafting_inventory_follows_nearby_fire", "[crafting][inventory]" )
+{
+    Character &c = get_player_character();
+    clear_avatar();
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms spot = c.pos_bub() + tripoint_east;
+
+    REQUIRE( here.add_field( spot, fd_fire, 1 ) );
+    REQUIRE( c.crafting_inventory().charges_of( itype_fire ) == 1 );
+    calendar::turn += 1_turns;
+
+    // The fire burns out while the fields are processed
+    here.get_field( spot, fd_fire )->set_field_intensity( 0 );
+    here.process_fields();
+    REQUIRE( here.get_field( spot, fd_fire ) == nullptr );
+    CHECK( c.crafting_inventory().charges_of( itype_fire ) == 0 );
+}
+
+TEST_CASE( "copied_inventory_counts_its_own_items", "[crafting][inventory]" )
+{
+    inventory original;
+    original += item( itype_hammer );
+    // Bins the original's items
+    REQUIRE( original.count_item( itype_hammer ) == 1 );
+
+    const inventory copy = original;
+    original.clear();
+    CHECK( copy.count_item( itype_hammer ) == 1 );
+    CHECK( original.count_item( itype_hammer ) == 0 );
+}
+
+TEST_CASE( "inventory_quality_levels_follow_its_items", "[crafting][inventory]" )
+{
+    inventory inv;
+    CHECK_FALSE( inv.has_quality( qual_HAMMER ) );
+
+    inv += item( itype_hammer );
+    const int level = item( itype_hammer ).get_quality( qual_HAMMER );
+    REQUIRE( level > 0 );
+    CHECK( inv.has_quality( qual_HAMMER, level ) );
+    CHECK_FALSE( inv.has_quality( qual_HAMMER, level + 1 ) );
+    CHECK_FALSE( inv.has_quality( qual_HAMMER, level, 2 ) );
+
+    inv += item( itype_hammer );
+    CHECK( inv.has_quality( qual_HAMMER, level, 2 ) );
+    CHECK( inv.has_quality( qual_HAMMER, 1, 2 ) );
+}
+
 TEST_CASE( "tools_use_charge_to_craft", "[crafting][charge]" )
 {
     std::vector<item> tools;
@@ -2333,6 +2519,19 @@ TEST_CASE( "pseudo_tools_in_crafting_inventory", "[crafting][tools]" )
                     CHECK( player.crafting_inventory().count_item( itype_water_faucet ) == 1 );
                     CHECK( player.crafting_inventory().charges_of( itype_water ) == 50 );
                 }
+                THEN( "crafting inventory follows the tank contents on the next turn" ) {
+                    player.invalidate_crafting_inventory();
+                    REQUIRE( player.crafting_inventory().charges_of( itype_water ) == 50 );
+                    // Draining a tank in place doesn't touch any map items
+                    charges = 20;
+                    for( const vpart_reference &tank : veh->get_avail_parts(
+                             vpart_bitflags::VPFLAG_FLUIDTANK ) ) {
+                        tank.part().ammo_set( itype_water, charges );
+                        charges = 0;
+                    }
+                    calendar::turn += 1_turns;
+                    CHECK( player.crafting_inventory().charges_of( itype_water ) == 20 );
+                }
             }
             WHEN( "the vehicle has two water faucets" ) {
                 REQUIRE( veh->install_part( point_south, vpart_water_faucet ) >= 0 );
@@ -356,6 +356,15 @@ TEST_CASE( "has_effect_with_flag", "[creature][effect][has][flag]" )
         THEN( "has_effect_with_flag is true" ) {
             CHECK( mummy.has_effect_with_flag( json_flag_INVISIBLE ) );
         }
+
+        AND_WHEN( "the effect with the flag is removed again" ) {
+            REQUIRE( mummy.has_effect_with_flag( json_flag_INVISIBLE ) );
+            mummy.remove_effect( effect_invisibility );
+
+            THEN( "has_effect_with_flag is false" ) {
+                CHECK_FALSE( mummy.has_effect_with_flag( json_flag_INVISIBLE ) );
+            }
+        }
     }
 }
 
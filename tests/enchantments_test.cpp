@@ -361,6 +361,32 @@ TEST_CASE( "Enchantment_BONUS_DODGE_test", "[magic][enchantments]" )
     REQUIRE( guy.get_num_dodges() == 2 );
 }
 
+TEST_CASE( "Enchantments_follow_swapped_wielded_relics", "[magic][enchantments]" )
+{
+    clear_map();
+    Character &guy = get_player_character();
+    clear_avatar();
+
+    INFO( "Wielding a relic that gives +3 dodges" );
+    guy.set_wielded_item( item( "test_BONUS_DODGE_ench_item_1" ) );
+    guy.recalculate_enchantment_cache();
+    advance_turn( guy );
+    REQUIRE( guy.get_num_dodges() == 4 );
+
+    // The new weapon takes the place of the old one, at the same address
+    INFO( "Wielding a relic that gives +4 dodges and then halves them instead" );
+    guy.set_wielded_item( item( "test_BONUS_DODGE_ench_item_2" ) );
+    guy.recalculate_enchantment_cache();
+    advance_turn( guy );
+    CHECK( guy.get_num_dodges() == 2 );
+
+    INFO( "Wielding the first relic again" );
+    guy.set_wielded_item( item( "test_BONUS_DODGE_ench_item_1" ) );
+    guy.recalculate_enchantment_cache();
+    advance_turn( guy );
+    CHECK( guy.get_num_dodges() == 4 );
+}
+
 TEST_CASE( "Enchantment_PAIN_PENALTY_MOD_test", "[magic][enchantments]" )
 {
     clear_map();
@@ -3,17 +3,26 @@
 #include <utility>
 #include <vector>
 
+#include "activity_actor_definitions.h"
 #include "basecamp.h"
 #include "cata_catch.h"
+#include "character.h"
 #include "clzones.h"
 #include "coordinates.h"
 #include "faction.h"
+#include "inventory.h"
+#include "item.h"
+#include "item_location.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "overmap.h"
 #include "overmapbuffer.h"
 #include "player_helpers.h"
 
+static const itype_id itype_2x4( "2x4" );
+static const itype_id itype_backpack( "backpack" );
+static const itype_id itype_nail( "nail" );
+
 static const vitamin_id vitamin_mutagen( "mutagen" );
 static const vitamin_id vitamin_mutant_toxin( "mutant_toxin" );
 
@@ -91,4 +100,63 @@ TEST_CASE( "camp_calorie_counting", "[camp]" )
         REQUIRE( food_supply.get_vitamin( vitamin_mutagen ) == 170 );
     }
 }
+
+TEST_CASE( "camp_crafting_inventory_follows_storage", "[camp]" )
+{
+    clear_avatar();
+    clear_map();
+    map &m = get_map();
+    const tripoint_abs_ms zone_loc = m.getglobal( tripoint{ 5, 5, 0 } );
+    mapgen_place_zone( zone_loc.raw(), zone_loc.raw(), zone_type_CAMP_STORAGE, your_fac, {},
+                       "storage" );
+    const tripoint_abs_omt this_omt = project_to<coords::omt>( zone_loc );
+    m.add_camp( this_omt, "faction_camp" );
+    std::optional<basecamp *> bcp = overmap_buffer.find_camp( this_omt.xy() );
+    basecamp *test_camp = *bcp;
+    test_camp->set_owner( your_fac );
+    test_camp->form_storage_zones( m, zone_loc );
+    REQUIRE( test_camp->get_storage_tiles().count( zone_loc ) == 1 );
+
+    const tripoint_bub_ms zone_local = m.bub_from_abs( zone_loc );
+    m.i_clear( zone_local );
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().amount_of( itype_2x4 ) == 0 );
+
+    m.add_item_or_charges( zone_local, item( itype_2x4 ) );
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().amount_of( itype_2x4 ) == 1 );
+    // Forming it again without changes gives the same inventory
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().amount_of( itype_2x4 ) == 1 );
+
+    m.add_item_or_charges( zone_local, item( itype_2x4 ) );
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().amount_of( itype_2x4 ) == 2 );
+
+    m.i_clear( zone_local );
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().amount_of( itype_2x4 ) == 0 );
+
+    // Charges change an existing stack in place
+    item &pile = m.add_item_or_charges( zone_local, item( itype_nail, calendar::turn, 10 ) );
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().charges_of( itype_nail ) == 10 );
+
+    m.add_item_or_charges( zone_local, item( itype_nail, calendar::turn, 5 ) );
+    REQUIRE( m.i_at( zone_local ).size() == 1 );
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().charges_of( itype_nail ) == 15 );
+
+    Character &you = get_player_character();
+    you.setpos( zone_local + tripoint_west );
+    you.wear_item( item( itype_backpack ) );
+    const std::vector<item_location> targets = { item_location( map_cursor( zone_local ), &pile ) };
+    you.set_moves( 100 );
+    you.assign_activity( pickup_activity_actor( targets, { 4 }, you.pos_bub(), false ) );
+    you.activity.do_turn( you );
+    REQUIRE( m.i_at( zone_local ).only_item().charges == 11 );
+    test_camp->form_crafting_inventory( m );
+    CHECK( test_camp->get_crafting_inventory().charges_of( itype_nail ) == 11 );
+}
+
 // TODO: Tests for: Check calorie display at various activity levels, camp crafting works as expected (consumes inputs, returns outputs+byproducts, costs calories)
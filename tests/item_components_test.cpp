@@ -0,0 +1,80 @@
+#include <vector>
+
+#include "calendar.h"
+#include "cata_catch.h"
+#include "item.h"
+#include "item_components.h"
+#include "ret_val.h"
+#include "type_id.h"
+
+static const itype_id itype_2x4( "2x4" );
+static const itype_id itype_cotton_patchwork( "cotton_patchwork" );
+static const itype_id itype_nail( "nail" );
+
+static item_components some_components()
+{
+    item_components comps;
+    item plank( itype_2x4 );
+    item nails( itype_nail, calendar::turn, 10 );
+    comps.add( plank );
+    comps.add( nails );
+    return comps;
+}
+
+TEST_CASE( "item_components_copies_share_until_modified", "[item][crafting]" )
+{
+    const item_components original = some_components();
+    item_components copy = original;
+    CHECK( copy.shares_storage_with( original ) );
+    CHECK( copy.size() == original.size() );
+
+    SECTION( "adding to a copy leaves the original alone" ) {
+        item patch( itype_cotton_patchwork );
+        copy.add( patch );
+        CHECK_FALSE( copy.shares_storage_with( original ) );
+        CHECK( copy.size() == original.size() + 1 );
+    }
+
+    SECTION( "removing from a copy leaves the original alone" ) {
+        const ret_val<item> removed = copy.remove( itype_2x4 );
+        REQUIRE( removed.success() );
+        CHECK( copy.size() == original.size() - 1 );
+        CHECK( original.size() == 2 );
+    }
+
+    SECTION( "changing items through a copy leaves the original alone" ) {
+        for( item_components::type_vector_pair &tvp : copy ) {
+            for( item &comp : tvp.second ) {
+                comp.set_damage( comp.max_damage() );
+            }
+        }
+        for( const item_components::type_vector_pair &tvp : original ) {
+            for( const item &comp : tvp.second ) {
+                CHECK( comp.damage() == 0 );
+            }
+        }
+    }
+}
+
+TEST_CASE( "empty_item_components_compare_equal", "[item][crafting]" )
+{
+    item_components a;
+    item_components b;
+    CHECK( a.empty() );
+    CHECK( a.shares_storage_with( b ) );
+    CHECK( a.begin() == a.end() );
+
+    item_components c = some_components();
+    c.clear();
+    CHECK( c.empty() );
+    CHECK( c.shares_storage_with( a ) );
+}
+
+TEST_CASE( "copies_of_a_craft_stack_by_shared_components", "[item][crafting][stack]" )
+{
+    item craft( itype_2x4 );
+    craft.components = some_components();
+    const item copy = craft;
+    CHECK( copy.components.shares_storage_with( craft.components ) );
+    CHECK( craft.stacks_with( copy, true ) );
+}
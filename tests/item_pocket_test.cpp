@@ -1578,6 +1578,44 @@ static item *add_item_to_best_pocket( Character &dummy, const item &it )
     return ret;
 }
 
+static item filled_backpack()
+{
+    item backpack( itype_test_backpack );
+    item socks( itype_test_socks );
+    while( backpack.put_in( socks, pocket_type::CONTAINER ).success() ) {
+        // stuff it until no more fit
+    }
+    return backpack;
+}
+
+TEST_CASE( "pocket_totals_cache_matches_uncached_totals", "[pocket][item]" )
+{
+    item backpack = filled_backpack();
+    const units::mass weight = backpack.weight();
+    const units::volume volume = backpack.volume();
+    const units::volume contained = backpack.get_total_contained_volume();
+    REQUIRE( contained > 0_ml );
+
+    item_pocket::totals_cache_scope totals_cache;
+    CHECK( backpack.weight() == weight );
+    CHECK( backpack.volume() == volume );
+    CHECK( backpack.get_total_contained_volume() == contained );
+    // Second lookups are served from the cache
+    CHECK( backpack.weight() == weight );
+    CHECK( backpack.get_total_contained_volume() == contained );
+}
+
+TEST_CASE( "best_pocket_benchmark", "[.][pocket][item][benchmark]" )
+{
+    item backpack = filled_backpack();
+    item_location loc;
+    const item socks( itype_test_socks );
+
+    BENCHMARK( "best_pocket in full backpack" ) {
+        return backpack.best_pocket( socks, loc ).second;
+    };
+}
+
 // Character::best_pocket
 // - See if wielded item can hold it - start with this as default
 // - For each worn item, see if best_pocket is better; if so, use it
@@ -1727,6 +1765,26 @@ TEST_CASE( "character_best_pocket", "[pocket][character][best]" )
     }
 }
 
+TEST_CASE( "stashing_a_batch_of_charges", "[pocket][character]" )
+{
+    Character &dummy = get_player_character();
+    clear_avatar();
+
+    item backpack( itype_test_backpack );
+    item socks( itype_test_socks );
+    REQUIRE( dummy.wear_item( backpack ) );
+    add_item_to_best_pocket( dummy, socks );
+
+    const itype_id ammo_id( "test_9mm_ammo" );
+    item ammo( ammo_id, calendar::turn_zero, 50 );
+    REQUIRE( ammo.count_by_charges() );
+
+    // All charges are distributed in one pass over the ranked pockets
+    CHECK( dummy.i_add_or_fill( ammo ).success() );
+    CHECK( dummy.charges_of( ammo_id ) == 50 );
+    CHECK( dummy.has_amount( itype_test_socks, 1 ) );
+}
+
 TEST_CASE( "guns_and_gunmods", "[pocket][gunmod]" )
 {
     item m4a1( "debug_modular_m4_carbine" );
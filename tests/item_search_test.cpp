@@ -0,0 +1,50 @@
+#include <functional>
+#include <string>
+
+#include "cata_catch.h"
+#include "item.h"
+#include "item_search.h"
+#include "type_id.h"
+
+static const itype_id itype_2x4( "2x4" );
+static const itype_id itype_hammer( "hammer" );
+
+static bool matches( const std::string &filter, const item &it )
+{
+    return item_filter_from_string( filter )( it );
+}
+
+TEST_CASE( "item_filter_matches_names_and_exclusions", "[item][search]" )
+{
+    const item plank( itype_2x4 );
+    const item hammer( itype_hammer );
+
+    CHECK( matches( "", plank ) );
+    CHECK( matches( "PLA", plank ) );
+    CHECK_FALSE( matches( "pla", hammer ) );
+    CHECK_FALSE( matches( "-pla", plank ) );
+    CHECK( matches( "-pla", hammer ) );
+    CHECK( matches( "pla,ham", plank ) );
+    CHECK( matches( "pla,ham", hammer ) );
+    CHECK_FALSE( matches( "ham,-hammer", hammer ) );
+}
+
+TEST_CASE( "item_filter_matches_categories_and_materials", "[item][search]" )
+{
+    const item plank( itype_2x4 );
+    const item hammer( itype_hammer );
+
+    // The same filter remembers what each category and material matched
+    const std::function<bool( const item & )> tools = item_filter_from_string( "c:tools" );
+    for( int i = 0; i < 2; ++i ) {
+        CHECK( tools( hammer ) );
+        CHECK_FALSE( tools( plank ) );
+    }
+    const std::function<bool( const item & )> steel = item_filter_from_string( "m:steel" );
+    for( int i = 0; i < 2; ++i ) {
+        CHECK( steel( hammer ) );
+        CHECK_FALSE( steel( plank ) );
+    }
+    CHECK( matches( "b:m:wood;c:spare", plank ) );
+    CHECK_FALSE( matches( "b:m:wood;c:spare", hammer ) );
+}
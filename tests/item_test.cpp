@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 #include "avatar.h"
@@ -13,9 +14,12 @@
 #include "enums.h"
 #include "flag.h"
 #include "game.h"
+#include "inventory.h"
 #include "item_category.h"
 #include "item_factory.h"
 #include "itype.h"
+#include "json.h"
+#include "json_loader.h"
 #include "math_defines.h"
 #include "monstergenerator.h"
 #include "mtype.h"
@@ -32,6 +36,8 @@ static const flag_id json_flag_FILTHY( "FILTHY" );
 static const flag_id json_flag_FIX_NEARSIGHT( "FIX_NEARSIGHT" );
 static const flag_id json_flag_HOT( "HOT" );
 
+static const harvest_drop_type_id harvest_drop_flesh( "flesh" );
+
 static const item_category_id item_category_clothing( "clothing" );
 static const item_category_id item_category_container( "container" );
 static const item_category_id item_category_food( "food" );
@@ -47,6 +53,8 @@ static const itype_id itype_test_waterproof_bag( "test_waterproof_bag" );
 
 static const json_character_flag json_flag_DEAF( "DEAF" );
 
+static const mtype_id mon_zombie( "mon_zombie" );
+
 TEST_CASE( "item_volume", "[item]" )
 {
     // Need to pick some item here which is count_by_charges and for which each
@@ -197,6 +205,21 @@ TEST_CASE( "stacking_over_time", "[item]" )
     }
 }
 
+TEST_CASE( "stacking_items_share_stacking_hash", "[item][stack]" )
+{
+    item A( "2x4" );
+    item B( "2x4" );
+    REQUIRE( A.stacks_with( B ) );
+    CHECK( A.stacking_hash() == B.stacking_hash() );
+
+    B.is_favorite = true;
+    REQUIRE_FALSE( A.stacks_with( B ) );
+    CHECK( A.stacking_hash() != B.stacking_hash() );
+
+    item C( "katana" );
+    CHECK( A.stacking_hash() != C.stacking_hash() );
+}
+
 TEST_CASE( "liquids_at_different_temperatures", "[item][temperature][stack][combine]" )
 {
     item liquid_hot( "test_liquid" );
@@ -279,6 +302,47 @@ TEST_CASE( "corpse_length_sanity_check", "[item]" )
     }
 }
 
+static item serialize_round_trip( const item &it )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.write( it );
+    item loaded;
+    loaded.deserialize( json_loader::from_string( os.str() ) );
+    return loaded;
+}
+
+TEST_CASE( "rarely_used_item_state_survives_copies_and_saves", "[item]" )
+{
+    item corpse = item::make_corpse( mon_zombie, calendar::turn, "Bob" );
+    corpse.set_dropped_from( harvest_drop_flesh );
+    REQUIRE( corpse.get_corpse_name() == "Bob" );
+    REQUIRE( corpse.get_dropped_from() == harvest_drop_flesh );
+
+    item copy = corpse;
+    copy.set_dropped_from( harvest_drop_type_id::NULL_ID() );
+    CHECK( copy.get_corpse_name() == "Bob" );
+    CHECK( copy.get_dropped_from().is_null() );
+    CHECK( corpse.get_dropped_from() == harvest_drop_flesh );
+
+    const item loaded = serialize_round_trip( corpse );
+    CHECK( loaded.get_corpse_name() == "Bob" );
+    CHECK( loaded.get_dropped_from() == harvest_drop_flesh );
+
+    const item plain = serialize_round_trip( item( "2x4" ) );
+    CHECK( plain.get_corpse_name().empty() );
+    CHECK( plain.get_dropped_from().is_null() );
+}
+
+#if defined(__x86_64__) && defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG)
+// Rarely set state lives in item::cold_data to keep every item small.  Raise the bound only
+// when a new member is really needed on every item.
+TEST_CASE( "item_layout_does_not_grow", "[item]" )
+{
+    CHECK( sizeof( item ) <= 448 );
+}
+#endif
+
 static void check_spawning_in_container( const std::string &item_type )
 {
     item test_item{ itype_id( item_type ) };
@@ -325,6 +389,32 @@ TEST_CASE( "item_variables_round-trip_accurately", "[item]" )
     CHECK( i.get_var( "B", 0.0 ) == 0.125 );
     i.set_var( "C", tripoint( 2, 3, 4 ) );
     CHECK( i.get_var( "C", tripoint() ) == tripoint( 2, 3, 4 ) );
+    i.set_var( "D", -2147483647LL - 1 );
+    CHECK( i.get_var( "D" ) == "-2147483648" );
+    CHECK( i.get_var( "D", 0 ) == -2147483648.0 );
+    i.set_var( "E", std::numeric_limits<int>::min() );
+    CHECK( i.get_var( "E" ) == "-2147483648" );
+    CHECK( i.get_var( "E", 0 ) == std::numeric_limits<int>::min() );
+}
+
+TEST_CASE( "item_variables_benchmark", "[.][item][benchmark]" )
+{
+    item i( "water" );
+    int counter = 0;
+    BENCHMARK( "set_var int" ) {
+        i.set_var( "countdown", ++counter );
+        return counter;
+    };
+    BENCHMARK( "get_var int" ) {
+        return i.get_var( "countdown", 0 );
+    };
+    BENCHMARK( "set_var double" ) {
+        i.set_var( "heat", 0.5 * ++counter );
+        return counter;
+    };
+    BENCHMARK( "get_var double" ) {
+        return i.get_var( "heat", 0.0 );
+    };
 }
 
 TEST_CASE( "water_affect_items_while_swimming_check", "[item][water][swimming]" )
@@ -1046,3 +1136,25 @@ TEST_CASE( "item_rotten_contents", "[item]" )
     //   butter
     CHECK( wrapper.get_category_of_contents().id == item_category_food );
 }
+
+TEST_CASE( "inventory_restack_benchmark", "[.][item][stack][benchmark]" )
+{
+    const std::vector<itype_id> types = {
+        itype_id( "rock" ), itype_id( "stick" ), itype_id( "sheet_cotton" ), itype_id( "katana" ),
+        itype_id( "2x4" )
+    };
+    inventory pile;
+    for( int i = 0; i < 5000; ++i ) {
+        item it( types[i % types.size()] );
+        // Every fifth item of a type differs, so not everything collapses into one stack
+        it.is_favorite = i % ( 5 * types.size() ) < types.size();
+        pile.add_item( it, false, false, false );
+    }
+    Character &you = get_player_character();
+
+    BENCHMARK( "restack 5000 items" ) {
+        inventory copy = pile;
+        copy.restack( you );
+        return copy.size();
+    };
+}
@@ -947,3 +947,22 @@ TEST_CASE( "nested_items_tname", "[item][tname]" )
         }
     }
 }
+
+TEST_CASE( "tname_cache_follows_item_changes", "[item][tname]" )
+{
+    item sheet_cotton( "sheet_cotton" );
+    const std::string plain = sheet_cotton.tname();
+
+    tname::name_cache_scope name_cache;
+    CHECK( sheet_cotton.tname() == plain );
+    CHECK( sheet_cotton.tname() == plain );
+
+    sheet_cotton.set_flag( flag_WET );
+    CHECK( sheet_cotton.tname() == "cotton sheet (wet)" );
+    sheet_cotton.unset_flag( flag_WET );
+    CHECK( sheet_cotton.tname() == plain );
+
+    // Quantity and segments are part of the key
+    CHECK( sheet_cotton.tname( 2 ) == "cotton sheets" );
+    CHECK( sheet_cotton.tname( 1, tname::item_name ) == "cotton sheet" );
+}
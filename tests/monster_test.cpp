@@ -9,13 +9,18 @@
 #include <utility>
 #include <vector>
 
+#include "bodypart.h"
 #include "cata_utility.h"
 #include "cata_catch.h"
 #include "cata_scope_helpers.h"
 #include "character.h"
+#include "character_id.h"
 #include "filesystem.h"
 #include "game.h"
 #include "game_constants.h"
+#include "item.h"
+#include "json.h"
+#include "json_loader.h"
 #include "line.h"
 #include "map.h"
 #include "map_helpers.h"
@@ -32,7 +37,11 @@ class item;
 
 using move_statistics = statistics<int>;
 
+static const itype_id itype_2x4( "2x4" );
+static const itype_id itype_9mm( "9mm" );
+
 static const mtype_id mon_dog_zombie_brute( "mon_dog_zombie_brute" );
+static const mtype_id mon_zombie( "mon_zombie" );
 
 static int moves_to_destination( const std::string &monster_type,
                                  const tripoint_bub_ms &start, const tripoint &end )
@@ -414,3 +423,118 @@ TEST_CASE( "limit_mod_size_bonus", "[monster]" )
     test_monster2.mod_size_bonus( 3 );
     CHECK( test_monster2.get_size() == creature_size::huge );
 }
+
+static std::string saved_monster( const monster &mon )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.write( mon );
+    return os.str();
+}
+
+static void load_monster( const std::string &saved, monster &loaded )
+{
+    loaded.deserialize( json_loader::from_string( saved ) );
+}
+
+// Adds a member that has no public setter to a saved monster record
+static void add_saved_member( std::string &saved, const std::string &name,
+                              const std::string &value )
+{
+    const std::string key = "\"" + name + "\":";
+    REQUIRE( saved.find( key ) == std::string::npos );
+    saved.insert( 1, key + value + "," );
+}
+
+TEST_CASE( "monster_with_default_state_survives_save_and_load", "[monster][json]" )
+{
+    const monster mon( mon_zombie );
+    const std::string saved = saved_monster( mon );
+
+    monster loaded;
+    load_monster( saved, loaded );
+    CHECK( loaded.type->id == mon_zombie );
+    CHECK( loaded.unique_name.empty() );
+    CHECK( loaded.nickname.empty() );
+    CHECK_FALSE( loaded.provocative_sound );
+    CHECK( loaded.friendly == 0 );
+    CHECK( loaded.mission_ids.empty() );
+    CHECK( loaded.mission_fused.empty() );
+    CHECK_FALSE( loaded.no_extra_death_drops );
+    CHECK_FALSE( loaded.is_dead() );
+    CHECK_FALSE( loaded.hallucination );
+    CHECK( loaded.aggro_character );
+    CHECK( loaded.ammo == mon.ammo );
+    CHECK( loaded.get_upgrade_time() == mon.get_upgrade_time() );
+    CHECK( loaded.inv.empty() );
+    CHECK( loaded.dissectable_inv.empty() );
+    CHECK_FALSE( loaded.dragged_foe_id.is_valid() );
+    CHECK_FALSE( loaded.mounted_player_id.is_valid() );
+    CHECK( loaded.grabbed_limbs.empty() );
+    CHECK( saved_monster( loaded ) == saved );
+}
+
+TEST_CASE( "monster_with_changed_state_survives_save_and_load", "[monster][json]" )
+{
+    monster mon( mon_zombie );
+    mon.unique_name = "Bob";
+    mon.nickname = "Bobby";
+    mon.set_dest( tripoint_abs_ms( 1, 2, 0 ) );
+    mon.provocative_sound = true;
+    mon.friendly = -1;
+    mon.mission_ids = { 5 };
+    mon.mission_fused = { "Alice" };
+    mon.no_extra_death_drops = true;
+    mon.hallucination = true;
+    mon.aggro_character = false;
+    mon.ammo[itype_9mm] = 5;
+    mon.inv.emplace_back( itype_2x4 );
+    mon.dissectable_inv.emplace_back( itype_2x4 );
+    mon.dragged_foe_id = character_id( 7 );
+    mon.mounted_player_id = character_id( 8 );
+    mon.grabbed_limbs.emplace( "arm_l" );
+
+    std::string saved = saved_monster( mon );
+    add_saved_member( saved, "dead", "true" );
+    add_saved_member( saved, "upgrade_time", "100" );
+    add_saved_member( saved, "baby_timer", "1000" );
+    add_saved_member( saved, "upgrades", mon.type->upgrades ? "false" : "true" );
+    add_saved_member( saved, "reproduces", mon.type->reproduces ? "false" : "true" );
+    add_saved_member( saved, "biosignatures", mon.type->biosignatures ? "false" : "true" );
+
+    monster loaded;
+    load_monster( saved, loaded );
+    CHECK( loaded.unique_name == "Bob" );
+    CHECK( loaded.nickname == "Bobby" );
+    CHECK( loaded.get_dest() == tripoint_abs_ms( 1, 2, 0 ) );
+    CHECK( loaded.provocative_sound );
+    CHECK( loaded.friendly == -1 );
+    CHECK( loaded.mission_ids == mon.mission_ids );
+    CHECK( loaded.mission_fused == mon.mission_fused );
+    CHECK( loaded.no_extra_death_drops );
+    CHECK( loaded.is_dead() );
+    CHECK( loaded.hallucination );
+    CHECK_FALSE( loaded.aggro_character );
+    CHECK( loaded.ammo == mon.ammo );
+    CHECK( loaded.get_upgrade_time() == 100 );
+    REQUIRE( loaded.inv.size() == 1 );
+    CHECK( loaded.inv.front().typeId() == itype_2x4 );
+    REQUIRE( loaded.dissectable_inv.size() == 1 );
+    CHECK( loaded.dissectable_inv.front().typeId() == itype_2x4 );
+    CHECK( loaded.dragged_foe_id == character_id( 7 ) );
+    CHECK( loaded.mounted_player_id == character_id( 8 ) );
+    CHECK( loaded.grabbed_limbs == mon.grabbed_limbs );
+
+    // The members without public getters are written out again and load the same way
+    const std::string resaved = saved_monster( loaded );
+    for( const char *name : {
+             "\"dead\":true", "\"baby_timer\":", "\"upgrades\":", "\"reproduces\":",
+             "\"biosignatures\":"
+         } ) {
+        CAPTURE( name );
+        CHECK( resaved.find( name ) != std::string::npos );
+    }
+    monster reloaded;
+    load_monster( resaved, reloaded );
+    CHECK( saved_monster( reloaded ) == resaved );
+}
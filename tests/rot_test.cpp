@@ -1,11 +1,13 @@
 #include "calendar.h"
 #include "cata_catch.h"
 #include "enums.h"
+#include "game.h"
 #include "item.h"
 #include "map.h"
 #include "point.h"
 #include "type_id.h"
 #include "weather.h"
+#include "weather_gen.h"
 
 static const flag_id json_flag_FROZEN( "FROZEN" );
 
@@ -134,3 +136,34 @@ TEST_CASE( "Hourly_rotpoints", "[rot]" )
     CHECK( normal_item.calc_hourly_rotpoints_at_temp( units::from_fahrenheit( 107 ) ) == Approx(
                20364.67 ) );
 }
+
+TEST_CASE( "Cached_weather_history_matches_generator", "[rot][temperature]" )
+{
+    // Items catching up on time spent outside the reality bubble look up the
+    // weather history through a per-turn cache; the result must not depend on it.
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+    set_map_temperature( units::from_fahrenheit( 65 ) );
+
+    item cold_cache_item( "meat_cooked" );
+    item warm_cache_item( "meat_cooked" );
+    cold_cache_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::NORMAL );
+    warm_cache_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::NORMAL );
+
+    calendar::turn += 3_days;
+    get_weather().clear_temp_cache();
+
+    cold_cache_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::NORMAL );
+    CHECK( !get_weather().weather_temperature_cache.empty() );
+    warm_cache_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::NORMAL );
+
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const time_point hour_ago = calendar::turn - 1_hours;
+    CHECK( get_weather().get_weather_temperature( tripoint_zero, hour_ago ) ==
+           wgen.get_weather_temperature( tripoint_zero, hour_ago, g->get_seed() ) );
+
+    CHECK( cold_cache_item.get_rot() == warm_cache_item.get_rot() );
+    CHECK( units::to_kelvin( cold_cache_item.temperature ) ==
+           units::to_kelvin( warm_cache_item.temperature ) );
+}
@@ -1,14 +1,28 @@
 #include "cata_catch.h"
 
+#include <algorithm>
+#include <climits>
+
 #include "calendar.h"
 #include "inventory.h"
 #include "item.h"
 #include "pocket_type.h"
 #include "ret_val.h"
 #include "type_id.h"
+#include "visitable.h"
 
+static const itype_id itype_any( "any" );
+static const itype_id itype_backpack( "backpack" );
+static const itype_id itype_bottle_plastic( "bottle_plastic" );
+static const itype_id itype_hammer( "hammer" );
+static const itype_id itype_pot( "pot" );
+static const itype_id itype_screwdriver( "screwdriver" );
 static const itype_id itype_water( "water" );
 
+static const quality_id qual_BOIL( "BOIL" );
+static const quality_id qual_HAMMER( "HAMMER" );
+static const quality_id qual_SCREW( "SCREW" );
+
 TEST_CASE( "visitable_summation" )
 {
     inventory test_inv;
@@ -24,3 +38,88 @@ TEST_CASE( "visitable_summation" )
 
     CHECK( test_inv.charges_of( itype_water, item::INFINITE_CHARGES ) > 1 );
 }
+
+// A backpack holding a hammer, an empty pot, and a pot holding a screwdriver
+static item packed_backpack()
+{
+    item backpack( itype_backpack );
+    item full_pot( itype_pot );
+    REQUIRE( full_pot.put_in( item( itype_screwdriver ), pocket_type::CONTAINER ).success() );
+    REQUIRE( backpack.put_in( full_pot, pocket_type::CONTAINER ).success() );
+    REQUIRE( backpack.put_in( item( itype_pot ), pocket_type::CONTAINER ).success() );
+    REQUIRE( backpack.put_in( item( itype_hammer ), pocket_type::CONTAINER ).success() );
+    return backpack;
+}
+
+static int visited_max_quality( const item &root, const quality_id &qual )
+{
+    int res = INT_MIN;
+    root.visit_items( [&res, &qual]( const item * e, item * ) {
+        res = std::max( res, e->get_quality( qual ) );
+        return VisitResponse::NEXT;
+    } );
+    return res;
+}
+
+static int visited_quality_count( const item &root, const quality_id &qual, int level )
+{
+    int qty = 0;
+    root.visit_items( [&qty, &qual, level]( const item * e, item * ) {
+        if( e->get_quality( qual ) >= level ) {
+            qty += e->count();
+        }
+        return VisitResponse::NEXT;
+    } );
+    return qty;
+}
+
+TEST_CASE( "visitable_quality_queries_match_full_visit", "[visitable][quality]" )
+{
+    const item backpack = packed_backpack();
+
+    for( const quality_id &qual : {
+             qual_BOIL, qual_HAMMER, qual_SCREW
+         } ) {
+        CAPTURE( qual.str() );
+        const int best = visited_max_quality( backpack, qual );
+        CHECK( backpack.max_quality( qual ) == best );
+        for( int level = 0; level <= best + 1; ++level ) {
+            CAPTURE( level );
+            const int count = visited_quality_count( backpack, qual, level );
+            if( count > 0 ) {
+                CHECK( backpack.has_quality( qual, level, count ) );
+            }
+            CHECK_FALSE( backpack.has_quality( qual, level, count + 1 ) );
+        }
+    }
+}
+
+TEST_CASE( "visitable_amount_queries_match_full_visit", "[visitable]" )
+{
+    item backpack = packed_backpack();
+    REQUIRE( backpack.put_in( item( itype_bottle_plastic ), pocket_type::CONTAINER ).success() );
+
+    CHECK( backpack.amount_of( itype_pot ) == 2 );
+    CHECK( backpack.amount_of( itype_screwdriver ) == 1 );
+    CHECK( backpack.amount_of( itype_water ) == 0 );
+    CHECK( backpack.amount_of( itype_any ) == 6 );
+    CHECK( backpack.has_amount( itype_pot, 2 ) );
+    CHECK_FALSE( backpack.has_amount( itype_pot, 3 ) );
+    CHECK( backpack.charges_of( itype_screwdriver ) == 0 );
+}
+
+TEST_CASE( "visitable_quality_query_benchmark", "[.][visitable][quality][benchmark]" )
+{
+    item backpack = packed_backpack();
+    for( int i = 0; i < 2; ++i ) {
+        item pot( itype_pot );
+        REQUIRE( pot.put_in( item( itype_screwdriver ), pocket_type::CONTAINER ).success() );
+        REQUIRE( backpack.put_in( pot, pocket_type::CONTAINER ).success() );
+    }
+    BENCHMARK( "max_quality" ) {
+        return backpack.max_quality( qual_SCREW );
+    };
+    BENCHMARK( "has_quality" ) {
+        return backpack.has_quality( qual_HAMMER, 1, 3 );
+    };
+}
@@ -5,6 +5,7 @@
 #include "map_helpers.h"
 
 static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
+static const zone_type_id zone_type_LOOT_FOOD( "LOOT_FOOD" );
 static const zone_type_id zone_type_LOOT_ITEM_GROUP( "LOOT_ITEM_GROUP" );
 
 using pset = std::unordered_set<tripoint_abs_ms>;
@@ -101,3 +102,29 @@ TEST_CASE( "zones_custom", "[zones]" )
         REQUIRE( nbp2.count( tripoint_abs_ms( m_zone_loc ) ) == 1 ); // container matches this zone
     }
 }
+
+TEST_CASE( "zone_distance_queries_follow_zone_areas", "[zones]" )
+{
+    clear_map();
+    map &m = get_map();
+    zone_manager &zmgr = zone_manager::get_manager();
+    tripoint_abs_ms const zone_start = m.getglobal( tripoint_bub_ms{ 10, 10, 0 } );
+    tripoint_abs_ms const zone_end = m.getglobal( tripoint_bub_ms{ 12, 14, 0 } );
+    mapgen_place_zone( zone_start.raw(), zone_end.raw(), zone_type_LOOT_FOOD, your_fac, {} );
+    tripoint_abs_ms const where = m.getglobal( tripoint_bub_ms{ 5, 12, 0 } );
+
+    CHECK_FALSE( zmgr.has_near( zone_type_LOOT_FOOD, where, 4 ) );
+    CHECK( zmgr.has_near( zone_type_LOOT_FOOD, where, 5 ) );
+
+    CHECK_FALSE( zmgr.get_nearest( zone_type_LOOT_FOOD, where, 4 ) );
+    CHECK( zmgr.get_nearest( zone_type_LOOT_FOOD, where, 5 ) ==
+           m.getglobal( tripoint_bub_ms{ 10, 12, 0 } ) );
+
+    // Only the zone's points within range are returned
+    CHECK( zmgr.get_near( zone_type_LOOT_FOOD, where, 4 ).empty() );
+    pset const in_range = zmgr.get_near( zone_type_LOOT_FOOD, where, 6 );
+    CHECK( in_range.size() == 10 );
+    CHECK( in_range.count( m.getglobal( tripoint_bub_ms{ 11, 14, 0 } ) ) == 1 );
+    CHECK( in_range.count( m.getglobal( tripoint_bub_ms{ 12, 12, 0 } ) ) == 0 );
+    CHECK( zmgr.get_near( zone_type_LOOT_FOOD, where, 7 ).size() == 15 );
+}